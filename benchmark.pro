@@ -0,0 +1,15 @@
+TARGET = benchmark
+TEMPLATE = app
+
+# headless, the benchmarks only use the model and compute layers
+CONFIG += console
+CONFIG -= qt app_bundle
+
+DESTDIR = main/bin
+OBJECTS_DIR = main/obj/benchmark
+
+HEADERS += main/include/benchmark/Benchmark.h
+SOURCES += main/src/benchmark/Benchmark.cpp
+SOURCES += main/src/benchmark/BenchmarkMain.cpp
+
+include(calccore.pri)
@@ -0,0 +1,15 @@
+TARGET = calcbatch
+TEMPLATE = app
+
+# command line batch evaluator, uses the engine without Qt
+CONFIG += console thread
+CONFIG -= qt app_bundle
+
+DESTDIR = main/bin
+OBJECTS_DIR = main/obj/calcbatch
+
+HEADERS += main/include/cli/BatchEvaluator.h
+SOURCES += main/src/cli/BatchEvaluator.cpp
+SOURCES += main/src/cli/BatchMain.cpp
+
+include(calccore.pri)
@@ -0,0 +1,90 @@
+# the Qt-free engine: model/ and controller/compute/, shared by every target
+
+QMAKE_CXXFLAGS += -std=c++17
+# MatrixMultiply splits large products over threads
+CONFIG += thread
+
+HEADERS += $$PWD/main/include/model/analyser/Interpreter.h
+SOURCES += $$PWD/main/src/model/analyser/Interpreter.cpp
+HEADERS += $$PWD/main/include/model/analyser/Lexer.h
+SOURCES += $$PWD/main/src/model/analyser/Lexer.cpp
+HEADERS += $$PWD/main/include/model/analyser/Node.h
+SOURCES += $$PWD/main/src/model/analyser/Node.cpp
+HEADERS += $$PWD/main/include/model/analyser/Parser.h
+SOURCES += $$PWD/main/src/model/analyser/Parser.cpp
+HEADERS += $$PWD/main/include/model/analyser/ParseSession.h
+SOURCES += $$PWD/main/src/model/analyser/ParseSession.cpp
+HEADERS += $$PWD/main/include/model/analyser/Token.h
+SOURCES += $$PWD/main/src/model/analyser/Token.cpp
+HEADERS += $$PWD/main/include/model/analyser/CompiledExpression.h
+SOURCES += $$PWD/main/src/model/analyser/CompiledExpression.cpp
+HEADERS += $$PWD/main/include/model/analyser/BatchKernels.h
+SOURCES += $$PWD/main/src/model/analyser/BatchKernels.cpp
+HEADERS += $$PWD/main/include/model/analyser/LinearSystem.h
+SOURCES += $$PWD/main/src/model/analyser/LinearSystem.cpp
+HEADERS += $$PWD/main/include/model/analyser/SymbolTable.h
+SOURCES += $$PWD/main/src/model/analyser/SymbolTable.cpp
+
+HEADERS += $$PWD/main/include/model/functions/Constant.h
+SOURCES += $$PWD/main/src/model/functions/Constant.cpp
+HEADERS += $$PWD/main/include/model/functions/Factorial.h
+SOURCES += $$PWD/main/src/model/functions/Factorial.cpp
+HEADERS += $$PWD/main/include/model/functions/Fraction.h
+SOURCES += $$PWD/main/src/model/functions/Fraction.cpp
+HEADERS += $$PWD/main/include/model/functions/Function.h
+SOURCES += $$PWD/main/src/model/functions/Function.cpp
+HEADERS += $$PWD/main/include/model/functions/Log.h
+SOURCES += $$PWD/main/src/model/functions/Log.cpp
+HEADERS += $$PWD/main/include/model/functions/Polynomial.h
+SOURCES += $$PWD/main/src/model/functions/Polynomial.cpp
+HEADERS += $$PWD/main/include/model/functions/Trig.h
+SOURCES += $$PWD/main/src/model/functions/Trig.cpp
+
+HEADERS += $$PWD/main/include/model/matrices/Matrix.h
+HEADERS += $$PWD/main/include/model/matrices/MatrixView.h
+HEADERS += $$PWD/main/include/model/matrices/MatrixExpression.h
+HEADERS += $$PWD/main/include/model/matrices/FixedMatrix.h
+SOURCES += $$PWD/main/src/model/matrices/Matrix.cpp
+HEADERS += $$PWD/main/include/model/matrices/LUDecomposition.h
+SOURCES += $$PWD/main/src/model/matrices/LUDecomposition.cpp
+HEADERS += $$PWD/main/include/model/matrices/QRDecomposition.h
+SOURCES += $$PWD/main/src/model/matrices/QRDecomposition.cpp
+HEADERS += $$PWD/main/include/model/matrices/FactorizationCache.h
+SOURCES += $$PWD/main/src/model/matrices/FactorizationCache.cpp
+HEADERS += $$PWD/main/include/model/matrices/MatrixMultiply.h
+SOURCES += $$PWD/main/src/model/matrices/MatrixMultiply.cpp
+HEADERS += $$PWD/main/include/model/matrices/SparseMatrix.h
+SOURCES += $$PWD/main/src/model/matrices/SparseMatrix.cpp
+HEADERS += $$PWD/main/include/model/matrices/IterativeSolver.h
+SOURCES += $$PWD/main/src/model/matrices/IterativeSolver.cpp
+HEADERS += $$PWD/main/include/model/matrices/MatrixFile.h
+SOURCES += $$PWD/main/src/model/matrices/MatrixFile.cpp
+HEADERS += $$PWD/main/include/model/matrices/MappedMatrix.h
+SOURCES += $$PWD/main/src/model/matrices/MappedMatrix.cpp
+HEADERS += $$PWD/main/include/model/matrices/Rational.h
+SOURCES += $$PWD/main/src/model/matrices/Rational.cpp
+HEADERS += $$PWD/main/include/model/matrices/ExactMatrix.h
+SOURCES += $$PWD/main/src/model/matrices/ExactMatrix.cpp
+HEADERS += $$PWD/main/include/model/sets/Sets.h
+SOURCES += $$PWD/main/src/model/sets/Sets.cpp
+
+HEADERS += $$PWD/main/include/controller/compute/Compute.h
+HEADERS += $$PWD/main/include/controller/compute/ComputeEquation.h
+HEADERS += $$PWD/main/include/controller/compute/ComputeSysOfLinearEqn.h
+HEADERS += $$PWD/main/include/controller/compute/ComputeMatrix.h
+HEADERS += $$PWD/main/include/controller/compute/ComputeSet.h
+HEADERS += $$PWD/main/include/controller/compute/ComputeFunction.h
+HEADERS += $$PWD/main/include/controller/compute/CalcCore.h
+SOURCES += $$PWD/main/src/controller/compute/ComputeEquation.cpp
+SOURCES += $$PWD/main/src/controller/compute/ComputeMatrix.cpp
+SOURCES += $$PWD/main/src/controller/compute/ComputeSet.cpp
+SOURCES += $$PWD/main/src/controller/compute/ComputeSysOfLinearEqn.cpp
+SOURCES += $$PWD/main/src/controller/compute/ComputeFunction.cpp
+SOURCES += $$PWD/main/src/controller/compute/CalcCore.cpp
+
+HEADERS += $$PWD/main/include/model/utilities/Utilities.h
+SOURCES += $$PWD/main/src/model/utilities/Utilities.cpp
+HEADERS += $$PWD/main/include/model/utilities/CpuFeatures.h
+SOURCES += $$PWD/main/src/model/utilities/CpuFeatures.cpp
+HEADERS += $$PWD/main/include/model/utilities/WorkerPool.h
+SOURCES += $$PWD/main/src/model/utilities/WorkerPool.cpp
@@ -0,0 +1,11 @@
+TARGET = calccore
+TEMPLATE = lib
+
+# static library of the engine, link with -lcalccore and include CalcCore.h
+CONFIG += staticlib
+CONFIG -= qt
+
+DESTDIR = main/lib
+OBJECTS_DIR = main/obj/calccore
+
+include(calccore.pri)
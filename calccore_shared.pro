@@ -0,0 +1,11 @@
+TARGET = calccore
+TEMPLATE = lib
+
+# shared library of the engine, link with -lcalccore and include CalcCore.h
+CONFIG += shared
+CONFIG -= qt
+
+DESTDIR = main/lib
+OBJECTS_DIR = main/obj/calccore_shared
+
+include(calccore.pri)
@@ -0,0 +1,68 @@
+/**
+ * @brief This class measures the throughput and latency of an operation.
+ *
+ * @details A Benchmark runs the operation of a case for each input size
+ * until a minimum time has passed, and reports the latency of one
+ * operation (mean, median, 90th percentile, min and max) and the number
+ * of items processed per second. Results are written one per line as
+ * JSON, or as CSV, so they can be compared between releases.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef CS3307_BENCHMARK_H
+#define CS3307_BENCHMARK_H
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class Benchmark {
+public:
+    // the work of one iteration, setup is not timed and may be empty
+    struct Run {
+        std::function<void()> setup;
+        std::function<void()> operation;
+    };
+
+    struct Case {
+        std::string name;
+        std::vector<int> sizes;
+        // prepares the inputs of one size, the size is also the items per operation
+        std::function<Run(int)> prepare;
+    };
+
+    struct Result {
+        std::string name;
+        int size;
+        long iterations;
+        double meanNs;
+        double medianNs;
+        double p90Ns;
+        double minNs;
+        double maxNs;
+        double itemsPerSecond;
+    };
+
+    explicit Benchmark(double minTimeMs);
+
+    ~Benchmark() = default;
+
+    std::vector<Result> run(const Case &benchmarkCase) const;
+
+    static void writeJson(std::ostream &os, const Result &result);
+
+    static void writeCsvHeader(std::ostream &os);
+
+    static void writeCsv(std::ostream &os, const Result &result);
+
+private:
+    double minTimeNs;
+
+    Result measure(const std::string &name, int size, const Run &run) const;
+};
+
+
+#endif //CS3307_BENCHMARK_H
@@ -0,0 +1,49 @@
+/**
+ * @brief This class evaluates a stream of expressions on a pool of threads.
+ *
+ * @details The BatchEvaluator reads one expression or equation per line and
+ * solves it through ComputeEquation::solve on a number of worker threads.
+ * The results are written in the order of the input as soon as they are
+ * ready, so the input can be much larger than memory. At most "window"
+ * lines are read ahead of the last line written.
+ *
+ * Each output line holds the answer, or every step separated by tabs, and
+ * optionally the time spent solving the line in microseconds as a last tab
+ * separated field. A line that cannot be solved gives "error: <message>".
+ * Empty input lines give empty output lines.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef CS3307_BATCHEVALUATOR_H
+#define CS3307_BATCHEVALUATOR_H
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+
+class BatchEvaluator {
+public:
+    struct Options {
+        unsigned threads;
+        bool steps;
+        bool timing;
+        std::size_t window;
+    };
+
+    explicit BatchEvaluator(Options options);
+
+    ~BatchEvaluator() = default;
+
+    std::size_t run(std::istream &in, std::ostream &out) const;
+
+    std::string evaluate(const std::string &line, bool &failed) const;
+
+private:
+    Options options;
+};
+
+
+#endif //CS3307_BATCHEVALUATOR_H
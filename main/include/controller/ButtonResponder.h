@@ -13,7 +13,6 @@
 #define BUTTON_RESPONDER_H
 
 #include <string>
-#include <QString>
 #include "../../include/controller/compute/Compute.h"
 #include "../../include/controller/compute/ComputeEquation.h"
 #include "../../include/controller/compute/ComputeMatrix.h"
@@ -29,6 +28,7 @@ class ButtonResponder{
         static std::vector<std::string> solveSysOfLinearEqnButtonResponse(std::vector<std::string> equations);
         static std::string solveSetButtonResponse(const std::vector<double>&, const std::vector<double>&, std::string operation);
         static double solveGraphButtonResponse(std::string function, std::string input);
+        static std::vector<double> solveGraphButtonResponse(std::string function, const std::vector<double> &inputs);
 };
 
 #endif //BUTTON_RESPONDER_H
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+ * @file CalcCore.h
+ * @author Mihir Kadiya
+ * @brief the public interface of the calccore library
+ * @details Solves equations, systems of linear equations, functions, matrices
+ * and sets without any GUI. This is the only header a program linking
+ * libcalccore needs, it does not depend on Qt. Errors are thrown as
+ * std::runtime_error with a message for the user.
+ * @version 1.0
+ */
+
+#ifndef CALC_CORE_H
+#define CALC_CORE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class CalcCore {
+    public:
+        // how a system of linear equations is tried with a Krylov method before elimination
+        struct IterativeOptions {
+            enum class Method {
+                ConjugateGradient,
+                BiCGSTAB,
+                GMRES
+            };
+
+            enum class Preconditioner {
+                None,
+                Jacobi,
+                ILU0
+            };
+
+            Method method = Method::GMRES;
+            Preconditioner preconditioner = Preconditioner::Jacobi;
+            // stop once ||b - Ax|| <= tolerance * ||b||
+            double tolerance = 1e-10;
+            int maxIterations = 1000;
+            // GMRES restarts after this many iterations
+            int restart = 30;
+        };
+
+        static std::vector<std::string> solveEquation(const std::string &equation);
+        static std::vector<std::string> solveSysOfLinearEqn(const std::vector<std::string> &equations);
+        static std::vector<std::string> solveSysOfLinearEqn(const std::vector<std::string> &equations,
+                                                            const IterativeOptions &options);
+        static std::vector<std::vector<std::string>> solveSysOfLinearEqn(const std::vector<std::string> &equations,
+                                                                         const std::vector<std::vector<double>> &constants);
+        static std::vector<std::string> solveSysOfLinearEqnExactly(const std::vector<std::string> &equations);
+        static void setFactorizationCacheSize(std::size_t values);
+        static void clearFactorizationCache();
+        static double evaluate(const std::string &function, double input);
+        static std::vector<double> evaluate(const std::string &function, const std::vector<double> &inputs);
+        static std::vector<std::vector<double>> solveMatrix(const std::vector<std::vector<double>> &matrix1,
+                                                            const std::vector<std::vector<double>> &matrix2,
+                                                            const char operations[3], double scalar1, double scalar2);
+        static void solveMatrixFiles(const std::string &path1, const std::string &path2, const char operations[3],
+                                     double scalar1, double scalar2, const std::string &outputPath);
+        static std::vector<double> solveSet(const std::vector<double> &set1, const std::vector<double> &set2,
+                                            char operation);
+};
+
+#endif //CALC_CORE_H
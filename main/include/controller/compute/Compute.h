@@ -20,6 +20,7 @@ class Compute{
                            char[3], double scalar1, double scalar2) const {};
         virtual std::string solve(const std::vector<double>&, const std::vector<double>&, const std::string&) {};
         virtual double solve(const std::string&, const std::string&) {};
+        virtual std::vector<double> solve(const std::string&, const std::vector<double>&) { return {}; };
 };
 
 #endif //COMPUTE_H
\ No newline at end of file
@@ -14,6 +14,7 @@
 class ComputeFunction : public Compute {
 public:
     double solve(const std::string&, const std::string&) override;
+    std::vector<double> solve(const std::string&, const std::vector<double>&) override;
 };
 
 #endif //GROUP29_COMPUTEFUNCTION_H
@@ -11,6 +11,7 @@
 
 #include "Compute.h"
 #include "../../../include/model/matrices/Matrix.h"
+#include "../../../include/model/matrices/MatrixExpression.h"
 
 /**
  *
@@ -19,6 +20,8 @@ class ComputeMatrix : public Compute{
     public:
         std::vector<std::vector<double>> solve(const std::vector<std::vector<double>>&, std::vector<std::vector<double>>&,
                         char[3], double scalar1, double scalar2) const override;
+        Matrix solve(ConstMatrixView matrix1, ConstMatrixView matrix2, const char operations[3],
+                     double scalar1, double scalar2) const;
 };
 
 #endif //COMPUTE_MATRIX_H
\ No newline at end of file
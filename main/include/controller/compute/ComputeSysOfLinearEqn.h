@@ -10,13 +10,48 @@
 #define COMPUTE_SLE_H
 
 #include "Compute.h"
+#include "../../../include/model/matrices/FactorizationCache.h"
 #include "../../../include/model/matrices/Matrix.h"
+#include "../../../include/model/matrices/IterativeSolver.h"
+#include "../../../include/model/matrices/SparseMatrix.h"
 #include <algorithm>
 #include <map>
 
 class ComputeSysOfLinearEqn : public Compute{
     public:
+        // Exact reduces with whole numbers and prints fractions, Floating rounds as doubles
+        enum class Arithmetic {
+            Floating,
+            Exact
+        };
+
+        ComputeSysOfLinearEqn() = default;
+        explicit ComputeSysOfLinearEqn(const IterativeSolver::Options &options);
+        explicit ComputeSysOfLinearEqn(Arithmetic arithmetic);
         std::vector<std::string> solve(const std::vector<std::string>&) const override ;
+        std::vector<std::vector<std::string>> solve(const std::vector<std::string> &equations,
+                                                    const std::vector<std::vector<double>> &constants) const;
+
+        // the factors of recently solved systems, shared by every ComputeSysOfLinearEqn
+        static FactorizationCache &factorizations();
+
+    private:
+        // square systems are first tried with an iterative solver, elimination is the fall back
+        bool iterative = false;
+        IterativeSolver::Options options;
+        Arithmetic arithmetic = Arithmetic::Floating;
+
+        std::vector<std::string> solveAugmented(const SparseMatrix &augmented_matrix,
+                                                const std::vector<std::string> &variable_names) const;
+        bool solveFactored(ConstMatrixView coefficients, ConstMatrixView constants,
+                           const std::vector<std::string> &variable_names,
+                           std::vector<std::vector<std::string>> &outputs) const;
+        bool solveIteratively(const SparseMatrix &augmented_matrix, const std::vector<std::string> &variable_names,
+                              std::vector<std::string> &output) const;
+        bool solveLeastSquares(const Matrix &augmented_matrix, const std::vector<std::string> &variable_names,
+                               std::vector<std::string> &output) const;
+        bool solveExactly(const Matrix &augmented_matrix, const std::vector<std::string> &variable_names,
+                          std::vector<std::string> &output) const;
 };
 
 #endif //COMPUTE_SLE_H
\ No newline at end of file
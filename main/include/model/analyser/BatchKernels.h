@@ -0,0 +1,52 @@
+/**
+ * @brief This class holds the array kernels used for batch evaluation.
+ *
+ * @details Every operation of a CompiledExpression has a kernel that runs it
+ * over a whole block of values. There is a scalar set, an SSE2 set and an
+ * AVX2/FMA set, and select() picks the widest one the running CPU supports.
+ * Trig kernels take degrees and log kernels are base 10, the same as the
+ * Trig and Log functions.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef CS3307_BATCHKERNELS_H
+#define CS3307_BATCHKERNELS_H
+
+class BatchKernels {
+public:
+    enum class Level {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    typedef void (*Binary)(const double *left, const double *right, double *out, int count);
+    typedef bool (*CheckedBinary)(const double *left, const double *right, double *out, int count);
+    typedef void (*Unary)(const double *in, double *out, int count);
+    typedef void (*IntegerPower)(const double *in, int exponent, double *out, int count);
+
+    Level level;
+    const char *name;
+
+    Binary add;
+    Binary subtract;
+    Binary multiply;
+    // returns true if any denominator was 0
+    CheckedBinary divide;
+    Binary power;
+    IntegerPower powerInteger;
+    Unary sqrt;
+    Unary sin;
+    Unary cos;
+    Unary tan;
+    Unary log;
+
+    static const BatchKernels &select();
+
+    static const BatchKernels &forLevel(Level level);
+};
+
+
+#endif //CS3307_BATCHKERNELS_H
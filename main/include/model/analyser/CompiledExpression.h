@@ -0,0 +1,87 @@
+/**
+ * @brief This class compiles a function string into a flat evaluation program.
+ *
+ * @details The CompiledExpression class runs the Lexer and Parser once and
+ * flattens the resulting Abstract Syntax Tree (AST) into an immutable postfix
+ * program. Every distinct variable gets a named slot, so the program can be
+ * evaluated for any binding of the variables without lexing, parsing or
+ * allocating again. Constant subtrees are folded while compiling.
+ * evaluateBatch() runs the program over whole arrays of inputs with the
+ * vectorized BatchKernels.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef CS3307_COMPILEDEXPRESSION_H
+#define CS3307_COMPILEDEXPRESSION_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../../../include/model/analyser/Node.h"
+#include "../../../include/model/analyser/BatchKernels.h"
+
+class CompiledExpression {
+public:
+    enum class OpCode {
+        Constant,
+        Variable,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Sin,
+        Cos,
+        Tan,
+        Log
+    };
+
+    struct Instruction {
+        OpCode op;
+        double value;
+        int slot;
+    };
+
+    explicit CompiledExpression(const std::string &function);
+
+    ~CompiledExpression() = default;
+
+    double evaluate(double x) const;
+
+    double evaluate(const double *bindings) const;
+
+    void evaluateBatch(const double *xs, double *ys, std::size_t count) const;
+
+    void evaluateBatch(const double *xs, double *ys, std::size_t count, const BatchKernels &kernels) const;
+
+    int getSlot(int variable) const;
+
+    const std::vector<int> &getVariables() const;
+
+    const std::vector<Instruction> &getProgram() const;
+
+    int getStackDepth() const;
+
+private:
+    std::vector<Instruction> program;
+    // the SymbolTable id of the variable in each slot
+    std::vector<int> variables;
+    int stackDepth;
+
+    void compile(Node *node);
+
+    void emit(OpCode op);
+
+    void emitConstant(double value);
+
+    double run(const double *bindings, double *stack, int stride) const;
+
+    void runBlock(const double *xs, double *ys, int count, const BatchKernels &kernels, double *scratch) const;
+
+    static double apply(OpCode op, double left, double right);
+};
+
+
+#endif //CS3307_COMPILEDEXPRESSION_H
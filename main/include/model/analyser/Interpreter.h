@@ -4,7 +4,8 @@
  * @details The Interpreter class takes an AST and reduces the
  * nodes by computing one operation at a time until one node remains.
  * The computation is carried out on the deepest internal node so that
- * the operation with highest precedence is done first.
+ * the operation with highest precedence is done first. The order of the
+ * reductions is scheduled once, in linear time, before reducing.
  *
  * @author Mihir Kadiya
  * @author Brandon Howe
@@ -15,8 +16,8 @@
 #define CS3307_INTERPRETER_H
 
 #include <vector>
-#include <unordered_map>
 #include "../../../include/model/analyser/Node.h"
+#include "../../../include/model/analyser/LinearSystem.h"
 
 class Interpreter {
 public:
@@ -30,19 +31,23 @@ public:
 
     double solve();
 
-    std::vector<char> getVariableNames();
+    std::vector<std::string> getVariableNames();
 
     std::vector<std::vector<double>> getAugmentedMatrix();
 
 private:
     Node *deepestInternalNode;
-    int maxDepth;
     Node *root;
 
+    // nodes left to reduce, the next one is at the back
+    std::vector<Node *> schedule;
+
     std::vector<Node *> trees;
-    std::unordered_map<char, std::vector<double>> map;
+    LinearSystem linearSystem;
+
+    void buildSchedule();
 
-    void setDeepestNode(Node *node, int depth);
+    void scheduleNodes(Node *node, int depth, std::vector<std::vector<Node *>> &levels);
 
     void groupFactorials(Node *node);
 
@@ -53,8 +58,6 @@ private:
     void reduce();
 
     void simplify() const;
-
-    void searchLinearEquation(Node *);
 };
 
 
@@ -12,8 +12,10 @@
 #ifndef CS3307_LEXER_H
 #define CS3307_LEXER_H
 
+#include <cstddef>
 #include <vector>
 #include <string>
+#include <string_view>
 #include "../../../include/model/analyser/Token.h"
 
 class Lexer {
@@ -23,6 +25,13 @@ public:
     std::vector<Token> tokenizer();
 
 private:
+    // a token that refers to its text in the input, it is only copied into a Token once it is kept
+    struct Lexeme {
+        Token::Type type;
+        std::size_t offset;
+        std::size_t length;
+    };
+
     std::string expr;
     int position;
     char currChar;
@@ -32,9 +41,11 @@ private:
     bool isDigit() const;
     bool isVariable() const;
     Token getNextToken();
+    Lexeme getNextLexeme();
+    std::string_view text(const Lexeme &lexeme) const;
 
-    Token number_factorial();
-    Token keyword();
+    Lexeme number_factorial();
+    Lexeme keyword();
 };
 
 
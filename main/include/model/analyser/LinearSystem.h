@@ -0,0 +1,75 @@
+/**
+ * @brief This class collects linear equations into an augmented matrix.
+ *
+ * @details Each equation tree is walked once and its terms are added to one
+ * sparse row, keyed by the index the variable got when it was first seen.
+ * A term that appears several times in an equation is summed in place, so an
+ * equation costs time in the size of its tree and a system costs time in the
+ * total size of its equations. Variables are told apart by their SymbolTable
+ * ids, never by their names. The augmented matrix is then laid out in CSR
+ * form with the variables in natural order (x2 before x10) and the constants
+ * last.
+ * Systems collected separately, e.g. on different threads, can be joined
+ * with append, which keeps the order of the equations.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef GROUP29_LINEAR_SYSTEM_H
+#define GROUP29_LINEAR_SYSTEM_H
+
+#include <string>
+#include <vector>
+
+#include "Node.h"
+#include "../matrices/SparseMatrix.h"
+
+class LinearSystem {
+public:
+    LinearSystem() = default;
+
+    ~LinearSystem() = default;
+
+    void addEquation(Node *equation);
+
+    void append(const LinearSystem &other);
+
+    int getEquations() const;
+
+    std::vector<std::string> getVariableNames() const;
+
+    SparseMatrix getAugmentedMatrix() const;
+
+private:
+    struct Term {
+        int variable;
+        double coefficient;
+    };
+
+    // the SymbolTable id of each variable, by the index it was given
+    std::vector<int> symbols;
+    // the index of each SymbolTable id, -1 for the ones that are not in the system
+    std::vector<int> indices;
+
+    // the terms of equation i are terms[rowStart[i]] up to terms[rowStart[i + 1]]
+    std::vector<Term> terms;
+    std::vector<int> rowStart = {0};
+    std::vector<double> constants;
+
+    // where each variable is in the terms of the current equation, -1 if it is not
+    std::vector<int> position;
+    double constant = 0;
+
+    void collect(Node *node, double scale);
+
+    void addTerm(int symbol, double coefficient);
+
+    int indexOf(int symbol);
+
+    std::vector<int> getColumns() const;
+
+    static bool isConstant(Node *node, double &value);
+};
+
+#endif //GROUP29_LINEAR_SYSTEM_H
@@ -37,6 +37,11 @@ public:
 
     ~Node() = default;
 
+    // nodes are allocated from the open ParseSession, see ParseSession
+    static void *operator new(std::size_t size);
+
+    static void operator delete(void *pointer);
+
     Node *getLeft();
 
     Node *getRight();
@@ -0,0 +1,68 @@
+/**
+ * @brief This class owns every AST and Function object of one evaluation.
+ *
+ * @details While a ParseSession is open, every Node, Token and Function
+ * created on the same thread is bump allocated from the session's memory
+ * blocks instead of the heap. Closing the session destroys the objects
+ * that are still alive and releases all of the blocks in one step, so
+ * parsing and interpreting an expression no longer leaks its tree.
+ * Objects created while no session is open come from the heap as before.
+ * Sessions can be nested, the innermost one is used.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef CS3307_PARSESESSION_H
+#define CS3307_PARSESESSION_H
+
+#include <cstddef>
+#include <vector>
+
+class ParseSession {
+public:
+    enum class Kind {
+        Node,
+        Token,
+        Function
+    };
+
+    ParseSession();
+
+    ~ParseSession();
+
+    ParseSession(const ParseSession &) = delete;
+
+    ParseSession &operator=(const ParseSession &) = delete;
+
+    static ParseSession *current();
+
+    static void *allocate(std::size_t size, Kind kind);
+
+    static void release(void *object);
+
+    std::size_t getAllocationCount() const;
+
+    std::size_t getBytesAllocated() const;
+
+    std::size_t getBlockCount() const;
+
+private:
+    struct Record;
+
+    // the newest allocation, each record links to the one before it
+    Record *records;
+    std::vector<char *> blocks;
+    char *cursor;
+    std::size_t remaining;
+
+    std::size_t allocationCount;
+    std::size_t bytesAllocated;
+
+    ParseSession *previous;
+
+    void *bump(std::size_t size);
+};
+
+
+#endif //CS3307_PARSESESSION_H
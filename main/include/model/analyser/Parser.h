@@ -27,8 +27,6 @@ private:
 
     std::tuple<Node *, Token *> factorialSubTree(Token *t);
 
-    void freeTree(Node *r);
-
 protected:
     std::tuple<Node *, Token *> createSubTree(Token *t);
 
@@ -0,0 +1,31 @@
+/**
+ * @brief This class gives every variable name a small integer id.
+ *
+ * @details A name is interned once, when the lexer first sees it, and from
+ * then on it is passed around and compared as its id, so "x1" to "x5000"
+ * cost no more than "x". Ids are dense and start at 0, so they can index a
+ * vector directly. The table is shared by every thread and never shrinks;
+ * lookups of names already in it only take a shared lock.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef GROUP29_SYMBOL_TABLE_H
+#define GROUP29_SYMBOL_TABLE_H
+
+#include <string>
+#include <string_view>
+
+class SymbolTable {
+public:
+    static int intern(std::string_view name);
+
+    static const std::string &name(int symbol);
+
+    static int size();
+
+    static bool naturalLess(int a, int b);
+};
+
+#endif //GROUP29_SYMBOL_TABLE_H
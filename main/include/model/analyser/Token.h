@@ -5,6 +5,8 @@
  * its value in a string form and its position in the given input string.
  * This class is used by the lexer to generate a set of tokens from the
  * input string and by the parser to create parse trees.
+ * Tokens made by the interpreter carry the computed Function instead of
+ * a string, it is only rendered when the text is needed.
  *
  * @author Mihir Kadiya
  */
@@ -13,8 +15,11 @@
 #ifndef CS3307_TOKEN_H
 #define CS3307_TOKEN_H
 
+#include <cstddef>
 #include <string>
 
+class Function;
+
 class Token {
 public:
     enum class Type {
@@ -39,19 +44,32 @@ public:
 
     Token(Type type, std::string value, int position);
 
+    Token(Type type, Function *function, int position);
+
     ~Token() = default;
 
+    // tokens are allocated from the open ParseSession, see ParseSession
+    static void *operator new(std::size_t size);
+
+    static void operator delete(void *pointer);
+
     Type getType() const;
 
     void setType(Type type);
 
     bool equals(Type type) const;
 
+    std::string getText() const;
+
     Token(const Token &t);
 
     Type type;
     std::string value;
+    // the computed value of the token, nullptr for tokens from the input
+    Function *function;
     int position;
+    // the id of the name of a variable token in the SymbolTable, -1 for other tokens
+    int symbol;
 };
 
 
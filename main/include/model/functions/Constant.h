@@ -20,7 +20,7 @@ private:
     double value;
 public:
     explicit Constant(double);
-    ~Constant();
+    ~Constant() override = default;
     bool isInputConstant() override;
     double getValue() override;
     double getCoef() override;
@@ -12,16 +12,28 @@
 #ifndef FUNCTION_H
 #define FUNCTION_H
 
+#include <cstddef>
 #include <iostream>
 
 class Function {
-protected:
-    std::string type;
 public:
-    Function();
-    ~Function() = default;
+    // the concrete type of a function, used to dispatch operations between two functions
+    enum class Kind {
+        Constant,
+        Fraction,
+        Polynomial,
+        Trig,
+        Log
+    };
+
+    explicit Function(Kind kind);
+    virtual ~Function() = default;
+
+    // functions are allocated from the open ParseSession, see ParseSession
+    static void *operator new(std::size_t size);
+    static void operator delete(void *pointer);
 
-    std::string getType();
+    Kind getKind() const;
 
     virtual bool isInputConstant() { return true; };
     virtual double getValue() { return -1; };
@@ -36,6 +48,9 @@ public:
     virtual Function *multiply(Function *) { return nullptr; };
     virtual Function *pow(Function *) { return nullptr; };
     virtual std::string toString() { return ""; };
+
+protected:
+    Kind kind;
 };
 
 Function *operator+(Function &f1, Function &f2);
@@ -21,10 +21,10 @@
 
 class Polynomial : public Function {
 public:
-    explicit Polynomial(const double arr[], int size, char variable);
-    Polynomial(double coefficient, char variable, int degree);
+    explicit Polynomial(const double arr[], int size, int variable);
+    Polynomial(double coefficient, int variable, int degree);
     ~Polynomial() = default;
-    char getVariable() const;
+    int getVariable() const;
 
     bool isInputConstant() override;
 
@@ -46,7 +46,8 @@ public:
 private:
     std::vector<double> coeff;
     int degree;
-    char variable;
+    // the id of the variable in the SymbolTable
+    int variable;
 
     void reduce();
 
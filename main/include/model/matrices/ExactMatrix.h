@@ -0,0 +1,48 @@
+/**
+ * @brief This class reduces a matrix to RREF without rounding
+ *
+ * @details Every row is scaled to whole numbers when the matrix is created, so
+ * a value such as 0.1 or 1/3 is taken as the fraction it stands for. The
+ * reduction is Bareiss' fraction-free Gauss-Jordan elimination: each step
+ * updates a value as (pivot * value - factor * pivot row value) / previous
+ * pivot, and that division is always exact. The values stay determinants of
+ * sub matrices of the input, so they grow with the size of the system rather
+ * than doubling every step, and no tolerance is needed to recognise a zero.
+ *
+ * After the reduction every pivot equals the same number, the determinant of
+ * the pivot columns, and at() divides by it to give the reduced values.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef EXACT_MATRIX_H
+#define EXACT_MATRIX_H
+
+#include <vector>
+
+#include "Matrix.h"
+#include "Rational.h"
+
+class ExactMatrix {
+    public:
+        explicit ExactMatrix(const Matrix &matrix);
+        ~ExactMatrix() = default;
+
+        void reduceToRREF();
+
+        Rational at(int row, int col) const;
+        int getRows() const;
+        int getCols() const;
+
+    private:
+        int rows;
+        int cols;
+        // row-major whole numbers, the value at (row, col) is values[...] / divisor
+        std::vector<long long> values;
+        long long divisor = 1;
+
+        long long &value(int row, int col);
+};
+
+#endif //EXACT_MATRIX_H
@@ -0,0 +1,72 @@
+/**
+ * @brief This class keeps the factors of recently solved coefficient matrices
+ *
+ * @details Systems that share their coefficients and differ only in the
+ * constants can reuse one factorization, so each new right hand side costs
+ * O(n^2) substitution instead of O(n^3) elimination. Square matrices are kept
+ * as LU factors and matrices with more rows than columns as QR factors.
+ * Entries are found by a hash of the coefficients and confirmed by comparing
+ * them, and the least recently used entry is dropped once the cache holds
+ * too many values. The limit is 2^20 values (8 MB) unless it is set. Safe to
+ * use from several threads.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef FACTORIZATION_CACHE_H
+#define FACTORIZATION_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "LUDecomposition.h"
+#include "Matrix.h"
+#include "QRDecomposition.h"
+
+class FactorizationCache {
+    public:
+        // at most one of the two is set, neither for a matrix with more columns than rows
+        struct Factors {
+            std::shared_ptr<const LUDecomposition> lu;
+            std::shared_ptr<const QRDecomposition> qr;
+        };
+
+        // finds the entries that may hold a matrix, equal matrices must hash the same
+        typedef std::uint64_t (*Hasher)(ConstMatrixView coefficients);
+
+        explicit FactorizationCache(std::size_t maxValues = std::size_t(1) << 20, Hasher hasher = hash);
+        ~FactorizationCache() = default;
+
+        Factors get(ConstMatrixView coefficients);
+        void clear();
+        void setMaxValues(std::size_t maxValues);
+        std::size_t size() const;
+
+        static std::uint64_t hash(ConstMatrixView coefficients);
+
+    private:
+        struct Entry {
+            std::uint64_t key;
+            Matrix coefficients;
+            Factors factors;
+        };
+
+        // the number of doubles held, counting the coefficients and the factors
+        std::size_t maxValues;
+        std::size_t values = 0;
+        Hasher hasher;
+
+        // most recently used first
+        std::list<Entry> entries;
+        std::unordered_multimap<std::uint64_t, std::list<Entry>::iterator> index;
+        mutable std::mutex mutex;
+
+        void evict(std::size_t size);
+        static bool matches(const Matrix &stored, ConstMatrixView coefficients);
+};
+
+#endif //FACTORIZATION_CACHE_H
@@ -0,0 +1,175 @@
+/**
+ * @brief This class represents a matrix whose size is known at compile time
+ *
+ * @details The values live in a std::array inside the object, so a FixedMatrix
+ * never allocates. Every loop has a constant bound and the determinant and
+ * inverse expand into straight-line cofactor formulas, which the compiler
+ * unrolls completely. Meant for the matrices of up to 4x4 that the GUI
+ * accepts; larger ones should use Matrix, whose LU factorisation is cheaper
+ * than cofactors from 5x5 on.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef FIXED_MATRIX_H
+#define FIXED_MATRIX_H
+
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#include "Matrix.h"
+
+template <int R, int C>
+class FixedMatrix {
+    static_assert(R >= 1 && R <= 4 && C >= 1 && C <= 4, "FixedMatrix is meant for sizes up to 4x4");
+
+    public:
+        constexpr FixedMatrix() : values{} {}
+
+        explicit FixedMatrix(ConstMatrixView view) : values{} {
+            if (view.rows() != R || view.cols() != C)
+                throw std::runtime_error("matrix dimensions are incompatable for this operation");
+            for (int row = 0; row < R; row++) {
+                for (int col = 0; col < C; col++)
+                    (*this)(row, col) = view(row, col);
+            }
+        }
+
+        static constexpr int rows() { return R; }
+        static constexpr int cols() { return C; }
+        constexpr double &operator()(int row, int col) { return values[row * C + col]; }
+        constexpr double operator()(int row, int col) const { return values[row * C + col]; }
+
+        constexpr FixedMatrix operator+(const FixedMatrix &other) const {
+            FixedMatrix result;
+            for (int i = 0; i < R * C; i++)
+                result.values[i] = values[i] + other.values[i];
+            return result;
+        }
+
+        constexpr FixedMatrix operator-(const FixedMatrix &other) const {
+            FixedMatrix result;
+            for (int i = 0; i < R * C; i++)
+                result.values[i] = values[i] - other.values[i];
+            return result;
+        }
+
+        constexpr FixedMatrix operator*(double scalar) const {
+            FixedMatrix result;
+            for (int i = 0; i < R * C; i++)
+                result.values[i] = values[i] * scalar;
+            return result;
+        }
+
+        template <int K>
+        constexpr FixedMatrix<R, K> operator*(const FixedMatrix<C, K> &other) const {
+            FixedMatrix<R, K> result;
+            for (int row = 0; row < R; row++) {
+                for (int col = 0; col < K; col++) {
+                    double sum = 0;
+                    for (int k = 0; k < C; k++)
+                        sum += (*this)(row, k) * other(k, col);
+                    result(row, col) = sum;
+                }
+            }
+            return result;
+        }
+
+        constexpr FixedMatrix<C, R> transpose() const {
+            FixedMatrix<C, R> result;
+            for (int row = 0; row < R; row++) {
+                for (int col = 0; col < C; col++)
+                    result(col, row) = (*this)(row, col);
+            }
+            return result;
+        }
+
+        /**
+         * @brief the matrix without one row and one column
+         * @details not called minor, which is a macro in the system headers of glibc and macOS
+         */
+        template <int N = R>
+        constexpr FixedMatrix<N - 1, C - 1> withoutRowCol(int skipRow, int skipCol) const {
+            FixedMatrix<N - 1, C - 1> result;
+            for (int row = 0, to = 0; row < R; row++) {
+                if (row == skipRow)
+                    continue;
+                for (int col = 0, toCol = 0; col < C; col++) {
+                    if (col != skipCol)
+                        result(to, toCol++) = (*this)(row, col);
+                }
+                to++;
+            }
+            return result;
+        }
+
+        /**
+         * @brief the determinant by cofactor expansion along the first row
+         */
+        constexpr double determinant() const {
+            static_assert(R == C, "only a square matrix has a determinant");
+            if constexpr (R == 1) {
+                return values[0];
+            } else if constexpr (R == 2) {
+                return values[0] * values[3] - values[1] * values[2];
+            } else {
+                double result = 0;
+                for (int col = 0; col < C; col++) {
+                    double term = values[col] * withoutRowCol(0, col).determinant();
+                    result += col % 2 == 0 ? term : -term;
+                }
+                return result;
+            }
+        }
+
+        /**
+         * @brief the inverse as the adjugate divided by the determinant
+         * @details a determinant within rounding error of 0, relative to the size of the
+         * values, counts as singular, the same way LUDecomposition decides
+         */
+        constexpr FixedMatrix inverse() const {
+            static_assert(R == C, "only a square matrix has an inverse");
+            double largest = 0;
+            for (double value: values)
+                largest = largest < absolute(value) ? absolute(value) : largest;
+            double scale = 1;
+            for (int i = 0; i < R; i++)
+                scale *= largest;
+
+            double det = determinant();
+            if (absolute(det) <= R * std::numeric_limits<double>::epsilon() * scale)
+                throw std::runtime_error("The inverse does not exist for this matrix");
+
+            FixedMatrix result;
+            if constexpr (R == 1) {
+                result.values[0] = 1 / det;
+            } else {
+                for (int row = 0; row < R; row++) {
+                    for (int col = 0; col < C; col++) {
+                        // the adjugate is the transpose of the cofactors
+                        double cofactor = withoutRowCol(col, row).determinant();
+                        result(row, col) = ((row + col) % 2 == 0 ? cofactor : -cofactor) / det;
+                    }
+                }
+            }
+            return result;
+        }
+
+        Matrix toMatrix() const {
+            Matrix result(R, C);
+            for (int row = 0; row < R; row++) {
+                for (int col = 0; col < C; col++)
+                    result(row, col) = (*this)(row, col);
+            }
+            return result;
+        }
+
+    private:
+        std::array<double, R * C> values;
+
+        static constexpr double absolute(double value) { return value < 0 ? -value : value; }
+};
+
+#endif //FIXED_MATRIX_H
@@ -0,0 +1,77 @@
+/**
+ * @brief This class solves large linear systems Ax = b iteratively
+ *
+ * @details Krylov methods only need products of A with vectors, so a sparse
+ * system costs O(non-zeros) per iteration instead of the O(n^3) of
+ * elimination. Conjugate gradient is for symmetric positive definite
+ * systems, BiCGSTAB and restarted GMRES for general ones. Each can be
+ * preconditioned with Jacobi (the diagonal) or ILU(0) (an incomplete LU
+ * factorization with the sparsity of A). Dense matrices are stored in
+ * sparse form, which is no worse than dense when most entries are set.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef ITERATIVE_SOLVER_H
+#define ITERATIVE_SOLVER_H
+
+#include <vector>
+
+#include "Matrix.h"
+#include "SparseMatrix.h"
+
+class IterativeSolver {
+    public:
+        enum class Method {
+            ConjugateGradient,
+            BiCGSTAB,
+            GMRES
+        };
+
+        enum class Preconditioner {
+            None,
+            Jacobi,
+            ILU0
+        };
+
+        struct Options {
+            Method method = Method::GMRES;
+            Preconditioner preconditioner = Preconditioner::Jacobi;
+            // stop once ||b - Ax|| <= tolerance * ||b||
+            double tolerance = 1e-10;
+            int maxIterations = 1000;
+            // GMRES restarts after this many iterations
+            int restart = 30;
+        };
+
+        struct Result {
+            std::vector<double> x;
+            bool converged;
+            int iterations;
+            // the relative residual ||b - Ax|| / ||b|| of x
+            double residual;
+        };
+
+        explicit IterativeSolver(const SparseMatrix &a);
+        explicit IterativeSolver(const Matrix &a);
+        ~IterativeSolver() = default;
+
+        Result solve(const std::vector<double> &b, const Options &options);
+
+    private:
+        SparseMatrix a;
+
+        // the ILU(0) factors share the pattern of a, diagonal[i] is the position of (i, i)
+        std::vector<double> lu;
+        std::vector<int> diagonal;
+
+        void factorILU0();
+        void precondition(Preconditioner preconditioner, const std::vector<double> &r, std::vector<double> &z) const;
+
+        Result conjugateGradient(const std::vector<double> &b, const Options &options) const;
+        Result biCGSTAB(const std::vector<double> &b, const Options &options) const;
+        Result gmres(const std::vector<double> &b, const Options &options) const;
+};
+
+#endif //ITERATIVE_SOLVER_H
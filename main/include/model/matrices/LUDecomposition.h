@@ -0,0 +1,42 @@
+/**
+ * @brief This class stores the LU factorization of a square matrix
+ *
+ * @details The matrix is factored once as PA = LU with partial pivoting, in
+ * O(n^3). The factors then give the determinant in O(n), solve a system in
+ * O(n^2) and the inverse in O(n^3). L (unit diagonal) and U are packed into
+ * one row-major n x n buffer.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef LU_DECOMPOSITION_H
+#define LU_DECOMPOSITION_H
+
+#include <vector>
+
+#include "Matrix.h"
+
+class LUDecomposition {
+    public:
+        explicit LUDecomposition(ConstMatrixView values);
+        ~LUDecomposition() = default;
+
+        int size() const;
+        bool isSingular() const;
+        double determinant() const;
+        std::vector<double> solve(const std::vector<double> &b) const;
+        Matrix solve(ConstMatrixView b) const;
+        Matrix inverse() const;
+
+    private:
+        int n;
+        std::vector<double> lu;
+        std::vector<int> pivots;
+        int sign;
+        bool singular;
+
+        void substitute(double *x) const;
+};
+
+#endif //LU_DECOMPOSITION_H
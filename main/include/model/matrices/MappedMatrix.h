@@ -0,0 +1,48 @@
+/**
+ * @brief This class gives read-only access to a matrix stored in a file
+ *
+ * @details The file is memory-mapped, so opening it costs nothing up front
+ * and only the pages that are read are loaded. Files of doubles in row-major
+ * order, as MatrixFile::write produces, are viewed in place without copying.
+ * Other data types and layouts are converted into memory once when opened.
+ * Views of the matrix are valid while the MappedMatrix exists.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef MAPPED_MATRIX_H
+#define MAPPED_MATRIX_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Matrix.h"
+
+class MappedMatrix {
+    public:
+        explicit MappedMatrix(const std::string &path);
+        ~MappedMatrix();
+
+        MappedMatrix(const MappedMatrix &) = delete;
+        MappedMatrix &operator=(const MappedMatrix &) = delete;
+
+        ConstMatrixView view() const;
+        bool isMapped() const;
+
+    private:
+        // the whole file, either mapped or read into buffer
+        const char *data = nullptr;
+        std::size_t size = 0;
+        bool mapped = false;
+        std::vector<char> buffer;
+
+        // the values when the file is not doubles in row-major order
+        Matrix converted = Matrix(0, 0);
+        const double *values = nullptr;
+        int rows = 0;
+        int cols = 0;
+};
+
+#endif //MAPPED_MATRIX_H
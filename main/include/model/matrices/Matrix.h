@@ -3,34 +3,57 @@
 
 #include <stdexcept>
 #include <vector>
-#include <cmath> 
+#include <cmath>
 
-class Matrix{ 
+#include "MatrixView.h"
+
+class Matrix{
     public:
-        Matrix(std::vector<std::vector<double>> input);
+        Matrix(const std::vector<std::vector<double>> &input);
+        Matrix(int rows, int cols);
+        explicit Matrix(ConstMatrixView view);
         ~Matrix() = default;
-        Matrix operator+(const Matrix& other);
-        Matrix operator-(const Matrix& other);
-        Matrix operator*(const Matrix& other);
+        Matrix operator+(const Matrix& other) const;
+        Matrix operator-(const Matrix& other) const;
+        Matrix operator*(const Matrix& other) const;
 
-        Matrix transpose();
-        Matrix scalarMulitply(double scaler);
+        Matrix transpose() const;
+        Matrix scalarMulitply(double scaler) const;
 
-        double cofactor(int row, int col);
-        double determinant();
-        Matrix inverse();
+        double cofactor(int row, int col) const;
+        double determinant() const;
+        Matrix inverse() const;
+        std::vector<double> solve(const std::vector<double> &b) const;
+        std::vector<double> leastSquares(const std::vector<double> &b) const;
 
         void swapRows(int first_row, int second_row);
         void scalarMulitplyRow(int row, double scalar);
         void AddScalarMulitpleOfOtherRow(int current_row, int row_to_add_from, double multiple);
         void reduceToRREF();
 
-        bool isSquare();
-        std::vector<std::vector<double>> getValues();
+        double &operator()(int row, int col) { return values[(size_t) row * cols + col]; }
+        double operator()(int row, int col) const { return values[(size_t) row * cols + col]; }
+
+        MatrixView view();
+        ConstMatrixView view() const;
+        MatrixView row(int row);
+        ConstMatrixView row(int row) const;
+        MatrixView col(int col);
+        ConstMatrixView col(int col) const;
+        MatrixView block(int row, int col, int num_rows, int num_cols);
+        ConstMatrixView block(int row, int col, int num_rows, int num_cols) const;
+
+        int getRows() const;
+        int getCols() const;
+        bool isSquare() const;
+        std::vector<std::vector<double>> getValues() const;
 
     private:
-        std::vector<std::vector<double>> matrix;
+        int rows;
+        int cols;
+        // row-major, row i starts at values[i * cols]
+        std::vector<double> values;
 };
 
 
-#endif //MATRIX_H
\ No newline at end of file
+#endif //MATRIX_H
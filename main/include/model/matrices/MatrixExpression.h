@@ -0,0 +1,146 @@
+/**
+ * @brief These classes describe element-wise matrix arithmetic without doing it
+ *
+ * @details An expression such as scaled(transposed(lazy(A)), s1) + scaled(lazy(B), s2)
+ * builds a small tree of expression objects instead of a Matrix for every step.
+ * Nothing is computed until evaluate() walks the output once and asks the tree
+ * for each value, so the whole chain costs one pass and one allocation.
+ * Expressions hold views of the matrices they read, which must outlive them.
+ *
+ * Only element-wise operations are lazy. A product or an inverse reads every
+ * value of its operands many times and is computed by Matrix as before.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef MATRIX_EXPRESSION_H
+#define MATRIX_EXPRESSION_H
+
+#include <stdexcept>
+
+#include "Matrix.h"
+
+template <typename E>
+class MatrixExpression {
+    public:
+        const E &self() const { return static_cast<const E &>(*this); }
+        int rows() const { return self().rows(); }
+        int cols() const { return self().cols(); }
+        double operator()(int row, int col) const { return self()(row, col); }
+};
+
+// the values of a Matrix, the leaves of every expression
+class MatrixOperand : public MatrixExpression<MatrixOperand> {
+    public:
+        explicit MatrixOperand(ConstMatrixView view) : view(view) {}
+        int rows() const { return view.rows(); }
+        int cols() const { return view.cols(); }
+        double operator()(int row, int col) const { return view(row, col); }
+
+    private:
+        ConstMatrixView view;
+};
+
+template <typename E>
+class Transposed : public MatrixExpression<Transposed<E>> {
+    public:
+        explicit Transposed(const E &expression) : expression(expression) {}
+        int rows() const { return expression.cols(); }
+        int cols() const { return expression.rows(); }
+        double operator()(int row, int col) const { return expression(col, row); }
+
+    private:
+        E expression;
+};
+
+template <typename E>
+class Scaled : public MatrixExpression<Scaled<E>> {
+    public:
+        Scaled(const E &expression, double scalar) : expression(expression), scalar(scalar) {}
+        int rows() const { return expression.rows(); }
+        int cols() const { return expression.cols(); }
+        double operator()(int row, int col) const { return expression(row, col) * scalar; }
+
+    private:
+        E expression;
+        double scalar;
+};
+
+template <typename L, typename R>
+class Sum : public MatrixExpression<Sum<L, R>> {
+    public:
+        Sum(const L &left, const R &right) : left(left), right(right) {
+            if (left.rows() != right.rows() || left.cols() != right.cols())
+                throw std::runtime_error("matrix dimensions are incompatable for this operation");
+        }
+        int rows() const { return left.rows(); }
+        int cols() const { return left.cols(); }
+        double operator()(int row, int col) const { return left(row, col) + right(row, col); }
+
+    private:
+        L left;
+        R right;
+};
+
+template <typename L, typename R>
+class Difference : public MatrixExpression<Difference<L, R>> {
+    public:
+        Difference(const L &left, const R &right) : left(left), right(right) {
+            if (left.rows() != right.rows() || left.cols() != right.cols())
+                throw std::runtime_error("matrix dimensions are incompatable for this operation");
+        }
+        int rows() const { return left.rows(); }
+        int cols() const { return left.cols(); }
+        double operator()(int row, int col) const { return left(row, col) - right(row, col); }
+
+    private:
+        L left;
+        R right;
+};
+
+inline MatrixOperand lazy(const Matrix &matrix) {
+    return MatrixOperand(matrix.view());
+}
+
+inline MatrixOperand lazy(ConstMatrixView view) {
+    return MatrixOperand(view);
+}
+
+template <typename E>
+Transposed<E> transposed(const MatrixExpression<E> &expression) {
+    return Transposed<E>(expression.self());
+}
+
+template <typename E>
+Scaled<E> scaled(const MatrixExpression<E> &expression, double scalar) {
+    return Scaled<E>(expression.self(), scalar);
+}
+
+template <typename L, typename R>
+Sum<L, R> operator+(const MatrixExpression<L> &left, const MatrixExpression<R> &right) {
+    return Sum<L, R>(left.self(), right.self());
+}
+
+template <typename L, typename R>
+Difference<L, R> operator-(const MatrixExpression<L> &left, const MatrixExpression<R> &right) {
+    return Difference<L, R>(left.self(), right.self());
+}
+
+/**
+ * @brief compute every value of an expression in one pass
+ * @param expression the expression to compute
+ * @return a new Matrix with the values
+ */
+template <typename E>
+Matrix evaluate(const MatrixExpression<E> &expression) {
+    const E &values = expression.self();
+    Matrix result(values.rows(), values.cols());
+    for (int row = 0; row < result.getRows(); row++) {
+        for (int col = 0; col < result.getCols(); col++)
+            result(row, col) = values(row, col);
+    }
+    return result;
+}
+
+#endif //MATRIX_EXPRESSION_H
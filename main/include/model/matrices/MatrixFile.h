@@ -0,0 +1,65 @@
+/**
+ * @brief This class reads and writes matrices in files
+ *
+ * @details The binary format is a 32 byte header followed by the values:
+ *
+ *     offset  size  field
+ *          0     4  magic "CMTX"
+ *          4     4  version, 1
+ *          8     4  data type, 1 for 64 bit doubles, 2 for 32 bit floats
+ *         12     4  layout, 0 for row-major, 1 for column-major
+ *         16     8  number of rows
+ *         24     8  number of columns
+ *         32        rows x cols values
+ *
+ * All fields and values are little-endian. write() always produces doubles
+ * in row-major order, which MappedMatrix can use straight from the file.
+ *
+ * CSV files hold one row per line with the values separated by commas. They
+ * are read in fixed size chunks, so only the parsed values are held in memory.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef MATRIX_FILE_H
+#define MATRIX_FILE_H
+
+#include <cstdint>
+#include <istream>
+#include <string>
+
+#include "Matrix.h"
+
+class MatrixFile {
+    public:
+        enum class DataType : std::uint32_t {
+            Float64 = 1,
+            Float32 = 2
+        };
+
+        enum class Layout : std::uint32_t {
+            RowMajor = 0,
+            ColumnMajor = 1
+        };
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            DataType dataType;
+            Layout layout;
+            std::uint64_t rows;
+            std::uint64_t cols;
+        };
+
+        static void write(const std::string &path, ConstMatrixView matrix);
+        static Matrix read(const std::string &path);
+        static Matrix readCsv(const std::string &path);
+        static Matrix readCsv(std::istream &in);
+
+        static Header parseHeader(const char *data, std::uint64_t size);
+        static std::uint64_t valueSize(DataType dataType);
+        static Matrix convert(const Header &header, const char *values);
+};
+
+#endif //MATRIX_FILE_H
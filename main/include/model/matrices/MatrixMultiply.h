@@ -0,0 +1,26 @@
+/**
+ * @brief This class multiplies matrices with a blocked, multi-threaded kernel
+ *
+ * @details The product is computed in tiles of the output. Each tile packs
+ * panels of both operands into contiguous slivers that fit the caches, and a
+ * micro-kernel keeps a 6x8 block of the output in registers while it walks
+ * the shared dimension. The AVX2/FMA micro-kernel is used when the running
+ * CPU supports it, otherwise a portable one. Tiles are handed out to the
+ * engine's shared WorkerPool, so large products use every core without
+ * paying to start threads each time.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef MATRIX_MULTIPLY_H
+#define MATRIX_MULTIPLY_H
+
+#include "MatrixView.h"
+
+class MatrixMultiply {
+    public:
+        static void multiply(ConstMatrixView a, ConstMatrixView b, MatrixView c, unsigned threads = 0);
+};
+
+#endif //MATRIX_MULTIPLY_H
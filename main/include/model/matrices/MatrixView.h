@@ -0,0 +1,81 @@
+/**
+ * @brief This class is a non-owning window onto the values of a Matrix
+ *
+ * @details A view is a pointer to the first value, a number of rows and columns
+ * and the distance between the starts of two rows (the stride). Rows, columns
+ * and rectangular sub-blocks of a row-major matrix are all views of this shape,
+ * so they can be read and written without copying. A view does not keep the
+ * matrix alive and must not outlive it.
+ *
+ * MatrixView writes to the values, ConstMatrixView only reads them.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef MATRIX_VIEW_H
+#define MATRIX_VIEW_H
+
+#include <cstddef>
+#include <stdexcept>
+
+template <typename T>
+class BasicMatrixView {
+    public:
+        BasicMatrixView(T *data, int rows, int cols, int stride) : values(data), numRows(rows), numCols(cols), rowStride(stride) {}
+
+        // a view of writable values can always be read through a const view
+        template <typename U>
+        BasicMatrixView(const BasicMatrixView<U> &other) : values(other.data()), numRows(other.rows()), numCols(other.cols()), rowStride(other.stride()) {}
+
+        T &operator()(int row, int col) const { return values[(std::ptrdiff_t) row * rowStride + col]; }
+
+        T *data() const { return values; }
+        T *rowData(int row) const { return values + (std::ptrdiff_t) row * rowStride; }
+        int rows() const { return numRows; }
+        int cols() const { return numCols; }
+        int stride() const { return rowStride; }
+        bool isSquare() const { return numRows == numCols; }
+
+        BasicMatrixView row(int row) const { return block(row, 0, 1, numCols); }
+        BasicMatrixView col(int col) const { return block(0, col, numRows, 1); }
+
+        /**
+         * @brief get a rectangular part of this view
+         * @param row the first row of the block
+         * @param col the first column of the block
+         * @param rows the number of rows in the block
+         * @param cols the number of columns in the block
+         * @return the view of the block, sharing the values of this view
+         */
+        BasicMatrixView block(int row, int col, int rows, int cols) const {
+            if (row < 0 || col < 0 || rows < 0 || cols < 0 || row + rows > numRows || col + cols > numCols)
+                throw std::runtime_error("matrix block is out of range");
+            return BasicMatrixView(values + (std::ptrdiff_t) row * rowStride + col, rows, cols, rowStride);
+        }
+
+        /**
+         * @brief copy the values of another view of the same shape into this one
+         * @param other the view to copy from, it must not overlap this one
+         */
+        template <typename U>
+        void assign(const BasicMatrixView<U> &other) const {
+            if (other.rows() != numRows || other.cols() != numCols)
+                throw std::runtime_error("matrix dimensions are incompatable for this operation");
+            for (int row = 0; row < numRows; row++) {
+                for (int col = 0; col < numCols; col++)
+                    (*this)(row, col) = other(row, col);
+            }
+        }
+
+    private:
+        T *values;
+        int numRows;
+        int numCols;
+        int rowStride;
+};
+
+typedef BasicMatrixView<double> MatrixView;
+typedef BasicMatrixView<const double> ConstMatrixView;
+
+#endif //MATRIX_VIEW_H
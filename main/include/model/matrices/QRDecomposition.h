@@ -0,0 +1,56 @@
+/**
+ * @brief This class stores the Householder QR factorization of a matrix
+ *
+ * @details A matrix with at least as many rows as columns is factored as
+ * A = QR in O(mn^2). Q is kept as the Householder vectors below the diagonal
+ * of R, in one row-major m x n buffer, and is never formed. The factors give
+ * the least squares solution of an overdetermined system without forming
+ * A^T A, whose condition number is the square of that of A.
+ *
+ * Columns are factored in panels. The reflectors of a panel are gathered
+ * into the compact WY form I - V T V^T and applied to the rest of the matrix
+ * together, so a tall matrix is swept once per panel rather than once per
+ * column.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef QR_DECOMPOSITION_H
+#define QR_DECOMPOSITION_H
+
+#include <vector>
+
+#include "Matrix.h"
+
+class QRDecomposition {
+    public:
+        struct Result {
+            // minimises ||b - Ax||
+            std::vector<double> x;
+            // ||b - Ax|| of x, 0 if the system is consistent
+            double residualNorm;
+        };
+
+        explicit QRDecomposition(ConstMatrixView values);
+        ~QRDecomposition() = default;
+
+        int rows() const;
+        int cols() const;
+        bool isRankDeficient() const;
+        Result solve(const std::vector<double> &b) const;
+        Matrix solve(ConstMatrixView b, std::vector<double> &residualNorms) const;
+        Matrix r() const;
+
+    private:
+        int m;
+        int n;
+        std::vector<double> qr;
+        std::vector<double> tau;
+        bool rankDeficient;
+
+        void factorPanel(int first, int width);
+        void applyPanel(int first, int width);
+};
+
+#endif //QR_DECOMPOSITION_H
@@ -0,0 +1,47 @@
+/**
+ * @brief This class represents an exact fraction of two integers
+ *
+ * @details The fraction is always kept in lowest terms with a positive
+ * denominator, so equal values have equal numerators and denominators.
+ * Arithmetic that does not fit in 64 bits throws std::runtime_error
+ * instead of wrapping around.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef RATIONAL_H
+#define RATIONAL_H
+
+#include <string>
+
+class Rational {
+    public:
+        Rational(long long numerator = 0, long long denominator = 1);
+        static Rational fromDouble(double value);
+
+        Rational operator+(const Rational &other) const;
+        Rational operator-(const Rational &other) const;
+        Rational operator*(const Rational &other) const;
+        Rational operator/(const Rational &other) const;
+        Rational operator-() const;
+        bool operator==(const Rational &other) const;
+        bool operator!=(const Rational &other) const;
+
+        long long getNumerator() const;
+        long long getDenominator() const;
+        bool isZero() const;
+        double toDouble() const;
+        std::string toString() const;
+
+        static long long gcd(long long a, long long b);
+        static long long multiply(long long a, long long b);
+        static long long add(long long a, long long b);
+        static long long subtract(long long a, long long b);
+
+    private:
+        long long numerator;
+        long long denominator;
+};
+
+#endif //RATIONAL_H
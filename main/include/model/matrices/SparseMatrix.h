@@ -0,0 +1,58 @@
+/**
+ * @brief This class represents matrices that are mostly zeros
+ *
+ * @details The non-zero values are stored in compressed sparse row (CSR) form:
+ * the values and their columns row after row, and the offset where every row
+ * starts. Memory grows with the number of non-zeros rather than with
+ * rows x cols. The transpose of a CSR matrix is the compressed sparse column
+ * form of the original, so both orders are available.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include <vector>
+
+#include "Matrix.h"
+
+class SparseMatrix {
+    public:
+        struct Entry {
+            int row;
+            int col;
+            double value;
+        };
+
+        SparseMatrix(int rows, int cols);
+        SparseMatrix(int rows, int cols, std::vector<Entry> entries);
+        explicit SparseMatrix(const Matrix &dense, double tolerance = 0);
+        ~SparseMatrix() = default;
+
+        Matrix toMatrix() const;
+        SparseMatrix transpose() const;
+        std::vector<double> multiply(const std::vector<double> &x) const;
+        void reduceToRREF();
+
+        double at(int row, int col) const;
+        int getRows() const;
+        int getCols() const;
+        int nonZeros() const;
+        double density() const;
+
+        const std::vector<int> &getRowStart() const;
+        const std::vector<int> &getColIndex() const;
+        const std::vector<double> &getValues() const;
+
+    private:
+        int rows;
+        int cols;
+        // the non-zeros of row i are values[rowStart[i]] up to values[rowStart[i + 1]], by column
+        std::vector<int> rowStart;
+        std::vector<int> colIndex;
+        std::vector<double> values;
+};
+
+#endif //SPARSE_MATRIX_H
@@ -0,0 +1,23 @@
+/**
+ * @brief This class reports the vector instruction sets of the running CPU
+ *
+ * @details The CpuFeatures class is used to pick vectorized kernels at
+ * runtime, so one binary can use AVX2 where it exists and still run on
+ * older processors. Every check returns false on non x86 targets.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef GROUP29_CPUFEATURES_H
+#define GROUP29_CPUFEATURES_H
+
+class CpuFeatures {
+public:
+    CpuFeatures() = default;
+    ~CpuFeatures() = default;
+    static bool hasSse2();
+    static bool hasAvx2();
+};
+
+#endif //GROUP29_CPUFEATURES_H
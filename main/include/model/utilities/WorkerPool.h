@@ -0,0 +1,80 @@
+/**
+ * @brief This class runs a loop over a range on a fixed set of threads
+ *
+ * @details The threads are started once and reused for every call to run,
+ * which splits [begin, end) into one contiguous part per thread and returns
+ * when all parts are done. It is meant for algorithms that run many short
+ * parallel steps one after another, where starting threads for each step
+ * would cost more than the step itself. The calling thread does the first
+ * part, so a pool of one thread runs everything inline. If a part throws,
+ * run still waits for the other parts and then rethrows the first exception
+ * on the calling thread.
+ *
+ * The engine shares one pool with a thread per core, which is started on
+ * first use and taken with a Claim for the whole of a parallel algorithm.
+ * A caller that finds it claimed, including a nested caller on one of its
+ * own threads, runs inline instead of waiting.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef GROUP29_WORKERPOOL_H
+#define GROUP29_WORKERPOOL_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkerPool {
+public:
+    // holds the shared pool while it is alive, if no one else does
+    class Claim {
+    public:
+        explicit Claim(bool wanted = true);
+        ~Claim();
+
+        Claim(const Claim &) = delete;
+        Claim &operator=(const Claim &) = delete;
+
+        WorkerPool &pool() const;
+
+    private:
+        WorkerPool *claimed = nullptr;
+    };
+
+    explicit WorkerPool(unsigned threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    unsigned size() const;
+    void run(int begin, int end, const std::function<void(int, int)> &task);
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable startCondition;
+    std::condition_variable doneCondition;
+
+    // the current step, workers start on it when generation changes
+    const std::function<void(int, int)> *task = nullptr;
+    int begin = 0;
+    int end = 0;
+    unsigned generation = 0;
+    unsigned pending = 0;
+    bool stopping = false;
+
+    // the first exception thrown by a part of the current step
+    std::exception_ptr error;
+
+    void part(unsigned index, int &partBegin, int &partEnd) const;
+    void work(unsigned index);
+    void fail(std::exception_ptr exception);
+};
+
+#endif //GROUP29_WORKERPOOL_H
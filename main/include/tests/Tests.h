@@ -0,0 +1,34 @@
+/**
+ * @brief Checks shared by the headless regression tests.
+ *
+ * @details Every area has one function that runs its tests and reports
+ * each failed check on stderr. The test program runs them all and exits
+ * with a non-zero status if any check failed.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#ifndef CS3307_TESTS_H
+#define CS3307_TESTS_H
+
+#include <string>
+
+namespace Tests {
+    // record the result of one check, failures are printed with their description
+    void check(bool condition, const std::string &description);
+
+    // the number of failed checks so far
+    int failures();
+
+    void batchEvaluator();
+    void exactArithmetic();
+    void factorizationCache();
+    void fixedMatrix();
+    void iterativeSolver();
+    void matrixFile();
+    void sysOfLinearEqn();
+    void workerPool();
+}
+
+#endif //CS3307_TESTS_H
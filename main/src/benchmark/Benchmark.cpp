@@ -0,0 +1,166 @@
+/**
+ * @brief This class measures the throughput and latency of an operation.
+ *
+ * @details A Benchmark runs the operation of a case for each input size
+ * until a minimum time has passed, and reports the latency of one
+ * operation (mean, median, 90th percentile, min and max) and the number
+ * of items processed per second. Results are written one per line as
+ * JSON, or as CSV, so they can be compared between releases.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+#include "../../include/benchmark/Benchmark.h"
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+    // operations without a setup are timed in batches of at least this long
+    const double minBatchNs = 10000;
+
+    // stop sampling after this many times the minimum time, even if the setup dominates
+    const double maxWallFactor = 20;
+
+    const int minSamples = 5;
+
+    double elapsedNs(Clock::time_point start, Clock::time_point end) {
+        return std::chrono::duration<double, std::nano>(end - start).count();
+    }
+}
+
+/**
+ * parameterised constructor
+ * @param minTimeMs the minimum time to measure each size for, in milliseconds
+ */
+Benchmark::Benchmark(double minTimeMs) {
+    Benchmark::minTimeNs = minTimeMs * 1e6;
+}
+
+/**
+ * measure a case for every one of its sizes
+ * @param benchmarkCase the case to measure
+ * @return the result for each size
+ */
+std::vector<Benchmark::Result> Benchmark::run(const Case &benchmarkCase) const {
+    std::vector<Result> results;
+    for (int size: benchmarkCase.sizes) {
+        Run run = benchmarkCase.prepare(size);
+        results.push_back(measure(benchmarkCase.name, size, run));
+    }
+    return results;
+}
+
+/**
+ * time the operation of a run until the minimum time has passed
+ * @param name the name of the case
+ * @param size the input size of the run
+ * @param run the setup and operation to time
+ * @return the latency and throughput of the operation
+ */
+Benchmark::Result Benchmark::measure(const std::string &name, int size, const Run &run) const {
+    // warm up the caches and any lazily initialised state
+    if (run.setup) {
+        run.setup();
+    }
+    run.operation();
+
+    // fast operations without a setup are timed in batches, the clock is too coarse otherwise
+    long batch = 1;
+    if (!run.setup) {
+        while (batch < (1L << 20)) {
+            Clock::time_point start = Clock::now();
+            for (long i = 0; i < batch; i++) {
+                run.operation();
+            }
+            if (elapsedNs(start, Clock::now()) >= minBatchNs) {
+                break;
+            }
+            batch *= 2;
+        }
+    }
+
+    std::vector<double> samples;
+    double measuredNs = 0;
+    Clock::time_point wallStart = Clock::now();
+
+    while (measuredNs < minTimeNs || samples.size() < minSamples) {
+        if (run.setup) {
+            run.setup();
+        }
+
+        Clock::time_point start = Clock::now();
+        for (long i = 0; i < batch; i++) {
+            run.operation();
+        }
+        double sampleNs = elapsedNs(start, Clock::now());
+
+        measuredNs += sampleNs;
+        samples.push_back(sampleNs / batch);
+
+        if (samples.size() >= minSamples && elapsedNs(wallStart, Clock::now()) > maxWallFactor * minTimeNs) {
+            break;
+        }
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    Result result;
+    result.name = name;
+    result.size = size;
+    result.iterations = (long) samples.size() * batch;
+    result.meanNs = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    result.medianNs = samples[samples.size() / 2];
+    result.p90Ns = samples[(samples.size() * 9) / 10];
+    result.minNs = samples.front();
+    result.maxNs = samples.back();
+    result.itemsPerSecond = size * 1e9 / result.meanNs;
+    return result;
+}
+
+/**
+ * write a result as one line of JSON
+ * @param os the stream to write to
+ * @param result the result to write
+ */
+void Benchmark::writeJson(std::ostream &os, const Result &result) {
+    os << "{\"name\":\"" << result.name << "\""
+       << ",\"size\":" << result.size
+       << ",\"iterations\":" << result.iterations
+       << ",\"mean_ns\":" << result.meanNs
+       << ",\"median_ns\":" << result.medianNs
+       << ",\"p90_ns\":" << result.p90Ns
+       << ",\"min_ns\":" << result.minNs
+       << ",\"max_ns\":" << result.maxNs
+       << ",\"items_per_second\":" << result.itemsPerSecond
+       << "}\n";
+}
+
+/**
+ * write the column names of the CSV results
+ * @param os the stream to write to
+ */
+void Benchmark::writeCsvHeader(std::ostream &os) {
+    os << "name,size,iterations,mean_ns,median_ns,p90_ns,min_ns,max_ns,items_per_second\n";
+}
+
+/**
+ * write a result as one CSV row
+ * @param os the stream to write to
+ * @param result the result to write
+ */
+void Benchmark::writeCsv(std::ostream &os, const Result &result) {
+    os << result.name << ","
+       << result.size << ","
+       << result.iterations << ","
+       << result.meanNs << ","
+       << result.medianNs << ","
+       << result.p90Ns << ","
+       << result.minNs << ","
+       << result.maxNs << ","
+       << result.itemsPerSecond << "\n";
+}
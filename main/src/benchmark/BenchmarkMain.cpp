@@ -0,0 +1,241 @@
+/**
+ * @brief Entry point of the headless benchmark suite.
+ *
+ * @details Measures the analyser (Lexer, Parser, Interpreter), the compiled
+ * function evaluation, the Matrix operations and the Sets operations over a
+ * range of input sizes. The inputs are generated from a fixed seed so every
+ * run measures the same work. Results are printed one per line as JSON, or
+ * as CSV with --csv.
+ *
+ * usage: benchmark [--filter <text>] [--min-time <ms>] [--csv] [--list]
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../include/benchmark/Benchmark.h"
+#include "../../include/model/analyser/Lexer.h"
+#include "../../include/model/analyser/Parser.h"
+#include "../../include/model/analyser/Interpreter.h"
+#include "../../include/model/analyser/ParseSession.h"
+#include "../../include/controller/compute/ComputeFunction.h"
+#include "../../include/model/matrices/Matrix.h"
+#include "../../include/model/sets/Sets.h"
+
+namespace {
+    const unsigned seed = 3307;
+
+    /**
+     * generate a constant expression, division is left out so fractions stay small
+     * @param terms the number of numbers in the expression
+     * @return the expression
+     */
+    std::string makeExpression(int terms) {
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> digit(1, 9);
+        const char ops[] = {'+', '-', '*'};
+
+        std::string expression = std::to_string(digit(random));
+        for (int i = 1; i < terms; i++) {
+            expression += ops[random() % 3];
+            expression += std::to_string(digit(random));
+        }
+        return expression;
+    }
+
+    std::vector<std::vector<double>> makeMatrix(int rows, int cols) {
+        std::mt19937 random(seed + rows * 31 + cols);
+        std::uniform_int_distribution<int> value(-9, 9);
+
+        std::vector<std::vector<double>> values(rows, std::vector<double>(cols));
+        for (std::vector<double> &row: values) {
+            for (double &v: row) {
+                v = value(random);
+            }
+        }
+        return values;
+    }
+
+    std::vector<double> makeSet(int size, int offset) {
+        std::vector<double> set(size);
+        for (int i = 0; i < size; i++) {
+            set[i] = offset + 2 * i;
+        }
+        return set;
+    }
+
+    /**
+     * parse an expression into a fresh session for the interpreter cases
+     */
+    struct ParsedExpression {
+        std::vector<Token> tokens;
+        std::unique_ptr<ParseSession> session;
+        Node *root = nullptr;
+
+        void reset() {
+            // the old tree is released before the new session opens
+            session.reset();
+            session = std::make_unique<ParseSession>();
+            Parser parser;
+            parser.createParseTree(tokens);
+            root = parser.getRoot();
+        }
+    };
+
+    std::vector<Benchmark::Case> makeCases() {
+        std::vector<Benchmark::Case> cases;
+
+        cases.push_back({"lexer.tokenizer", {16, 256, 4096}, [](int size) {
+            auto expression = std::make_shared<std::string>(makeExpression(size));
+            return Benchmark::Run{nullptr, [expression]() {
+                Lexer lexer(*expression);
+                lexer.tokenizer();
+            }};
+        }});
+
+        cases.push_back({"parser.createParseTree", {16, 256, 4096}, [](int size) {
+            auto tokens = std::make_shared<std::vector<Token>>(Lexer(makeExpression(size)).tokenizer());
+            return Benchmark::Run{nullptr, [tokens]() {
+                ParseSession session;
+                Parser parser;
+                parser.createParseTree(*tokens);
+            }};
+        }});
+
+        cases.push_back({"interpreter.getSteps", {16, 64, 256}, [](int size) {
+            auto parsed = std::make_shared<ParsedExpression>();
+            parsed->tokens = Lexer(makeExpression(size)).tokenizer();
+            return Benchmark::Run{[parsed]() { parsed->reset(); }, [parsed]() {
+                Interpreter interpreter(parsed->root);
+                interpreter.getSteps();
+            }};
+        }});
+
+        cases.push_back({"interpreter.solve", {16, 256, 4096}, [](int size) {
+            auto parsed = std::make_shared<ParsedExpression>();
+            parsed->tokens = Lexer(makeExpression(size)).tokenizer();
+            return Benchmark::Run{[parsed]() { parsed->reset(); }, [parsed]() {
+                Interpreter interpreter(parsed->root);
+                interpreter.solve();
+            }};
+        }});
+
+        cases.push_back({"function.solve", {256, 4096, 65536}, [](int size) {
+            auto inputs = std::make_shared<std::vector<double>>(size);
+            for (int i = 0; i < size; i++) {
+                (*inputs)[i] = -10 + 20.0 * i / size;
+            }
+            return Benchmark::Run{nullptr, [inputs]() {
+                ComputeFunction compute;
+                compute.solve("3*x^2+2*x+sin(x)", *inputs);
+            }};
+        }});
+
+        cases.push_back({"matrix.multiply", {32, 256, 1024}, [](int size) {
+            auto a = std::make_shared<Matrix>(makeMatrix(size, size));
+            auto b = std::make_shared<Matrix>(makeMatrix(size, size));
+            return Benchmark::Run{nullptr, [a, b]() { *a * *b; }};
+        }});
+
+        cases.push_back({"matrix.determinant", {8, 64, 256}, [](int size) {
+            auto a = std::make_shared<Matrix>(makeMatrix(size, size));
+            return Benchmark::Run{nullptr, [a]() { a->determinant(); }};
+        }});
+
+        cases.push_back({"matrix.inverse", {8, 64, 256}, [](int size) {
+            auto a = std::make_shared<Matrix>(makeMatrix(size, size));
+            return Benchmark::Run{nullptr, [a]() { a->inverse(); }};
+        }});
+
+        cases.push_back({"matrix.reduceToRREF", {32, 256, 1024}, [](int size) {
+            auto values = std::make_shared<std::vector<std::vector<double>>>(makeMatrix(size, size + 1));
+            auto a = std::make_shared<Matrix>(*values);
+            return Benchmark::Run{[a, values]() { *a = Matrix(*values); }, [a]() { a->reduceToRREF(); }};
+        }});
+
+        cases.push_back({"sets.union", {64, 1024, 8192}, [](int size) {
+            auto a = std::make_shared<std::vector<double>>(makeSet(size, 0));
+            auto b = std::make_shared<std::vector<double>>(makeSet(size, size));
+            return Benchmark::Run{nullptr, [a, b]() { Sets::Union(*a, *b); }};
+        }});
+
+        cases.push_back({"sets.intersection", {64, 1024, 8192}, [](int size) {
+            auto a = std::make_shared<std::vector<double>>(makeSet(size, 0));
+            auto b = std::make_shared<std::vector<double>>(makeSet(size, size));
+            return Benchmark::Run{nullptr, [a, b]() { Sets::intersection(*a, *b); }};
+        }});
+
+        cases.push_back({"sets.subtraction", {64, 1024, 8192}, [](int size) {
+            auto a = std::make_shared<std::vector<double>>(makeSet(size, 0));
+            auto b = std::make_shared<std::vector<double>>(makeSet(size, size));
+            return Benchmark::Run{nullptr, [a, b]() { Sets::Subtraction(*a, *b); }};
+        }});
+
+        return cases;
+    }
+
+    void usage() {
+        std::cerr << "usage: benchmark [--filter <text>] [--min-time <ms>] [--csv] [--list]\n";
+    }
+}
+
+int main(int argc, char *argv[]) {
+    std::string filter;
+    double minTimeMs = 200;
+    bool csv = false;
+    bool list = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            minTimeMs = std::atof(argv[++i]);
+        } else if (arg == "--csv") {
+            csv = true;
+        } else if (arg == "--list") {
+            list = true;
+        } else {
+            usage();
+            return 1;
+        }
+    }
+
+    Benchmark benchmark(minTimeMs);
+    if (csv && !list) {
+        Benchmark::writeCsvHeader(std::cout);
+    }
+
+    for (const Benchmark::Case &benchmarkCase: makeCases()) {
+        if (benchmarkCase.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        if (list) {
+            std::cout << benchmarkCase.name << "\n";
+            continue;
+        }
+
+        try {
+            for (const Benchmark::Result &result: benchmark.run(benchmarkCase)) {
+                if (csv) {
+                    Benchmark::writeCsv(std::cout, result);
+                } else {
+                    Benchmark::writeJson(std::cout, result);
+                }
+                std::cout.flush();
+            }
+        } catch (std::exception &e) {
+            std::cerr << benchmarkCase.name << ": " << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+/**
+ * @brief This class evaluates a stream of expressions on a pool of threads.
+ *
+ * @details The BatchEvaluator reads one expression or equation per line and
+ * solves it through ComputeEquation::solve on a number of worker threads.
+ * The results are written in the order of the input as soon as they are
+ * ready, so the input can be much larger than memory. At most "window"
+ * lines are read ahead of the last line written.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../../include/cli/BatchEvaluator.h"
+#include "../../include/controller/compute/ComputeEquation.h"
+
+namespace {
+    // a line in flight, slots are reused once their result is written
+    struct Slot {
+        std::string input;
+        std::string output;
+        bool failed = false;
+        bool done = false;
+    };
+
+    /**
+     * make an error message fit on one output line
+     * @details trailing line breaks are dropped, other line breaks and tabs become spaces
+     * so they can not split the line or its tab separated fields
+     * @param message the message of the exception
+     * @return the message on one line
+     */
+    std::string singleLine(std::string message) {
+        while (!message.empty() && (message.back() == '\n' || message.back() == '\r' || message.back() == '\t')) {
+            message.pop_back();
+        }
+        for (char &c: message) {
+            if (c == '\n' || c == '\r' || c == '\t') {
+                c = ' ';
+            }
+        }
+        return message;
+    }
+}
+
+/**
+ * parameterised constructor
+ * @param options the number of threads, output format and read ahead window
+ */
+BatchEvaluator::BatchEvaluator(Options options) {
+    if (options.threads == 0) {
+        options.threads = 1;
+    }
+    if (options.window < options.threads) {
+        options.window = options.threads;
+    }
+    BatchEvaluator::options = options;
+}
+
+/**
+ * solve one line and format its result
+ * @param line the expression or equation
+ * @param failed set to true if the line could not be solved
+ * @return the output line, without the line break
+ */
+std::string BatchEvaluator::evaluate(const std::string &line, bool &failed) const {
+    failed = false;
+    if (line.find_first_not_of(' ') == std::string::npos) {
+        return "";
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::string result;
+    try {
+        ComputeEquation compute;
+        std::vector<std::string> steps = compute.solve(line);
+
+        if (options.steps) {
+            for (std::size_t i = 0; i < steps.size(); i++) {
+                if (i > 0) {
+                    result += '\t';
+                }
+                result += steps[i];
+            }
+        } else {
+            result = steps.back();
+        }
+    } catch (std::exception &e) {
+        failed = true;
+        result = "error: " + singleLine(e.what());
+    }
+
+    if (options.timing) {
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        result += '\t' + std::to_string((long long) elapsed.count());
+    }
+    return result;
+}
+
+/**
+ * solve every line of the input and write the results in input order
+ * @param in the stream of expressions, one per line
+ * @param out the stream for the results, one per line
+ * @return the number of lines that could not be solved
+ */
+std::size_t BatchEvaluator::run(std::istream &in, std::ostream &out) const {
+    std::vector<Slot> slots(options.window);
+
+    std::mutex mutex;
+    // signalled when a line is read, a result is ready or a slot is free again
+    std::condition_variable readCondition;
+    std::condition_variable workCondition;
+    std::condition_variable writeCondition;
+
+    // sequence numbers: lines below nextWrite are written, below nextWork taken, below nextRead read
+    std::size_t nextRead = 0;
+    std::size_t nextWork = 0;
+    std::size_t nextWrite = 0;
+    bool endOfInput = false;
+    std::size_t failures = 0;
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            workCondition.wait(lock, [&]() { return nextWork < nextRead || endOfInput; });
+            if (nextWork == nextRead) {
+                return;
+            }
+
+            Slot &slot = slots[nextWork % slots.size()];
+            nextWork++;
+            std::string input = std::move(slot.input);
+
+            lock.unlock();
+            bool failed;
+            std::string output = evaluate(input, failed);
+            lock.lock();
+
+            slot.output = std::move(output);
+            slot.failed = failed;
+            slot.done = true;
+            writeCondition.notify_one();
+        }
+    };
+
+    auto writer = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            Slot &slot = slots[nextWrite % slots.size()];
+            if (!slot.done) {
+                if (endOfInput && nextWrite == nextRead) {
+                    out.flush();
+                    return;
+                }
+                // nothing to write yet, pass on what is buffered before waiting
+                lock.unlock();
+                out.flush();
+                lock.lock();
+                writeCondition.wait(lock, [&]() { return slot.done || (endOfInput && nextWrite == nextRead); });
+                continue;
+            }
+
+            std::string output = std::move(slot.output);
+            if (slot.failed) {
+                failures++;
+            }
+            slot.done = false;
+            nextWrite++;
+            readCondition.notify_one();
+
+            lock.unlock();
+            out << output << '\n';
+            lock.lock();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < options.threads; i++) {
+        threads.emplace_back(worker);
+    }
+    std::thread writerThread(writer);
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        readCondition.wait(lock, [&]() { return nextRead - nextWrite < slots.size(); });
+        slots[nextRead % slots.size()].input = std::move(line);
+        nextRead++;
+        workCondition.notify_one();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        endOfInput = true;
+    }
+    workCondition.notify_all();
+    writeCondition.notify_all();
+
+    for (std::thread &thread: threads) {
+        thread.join();
+    }
+    writerThread.join();
+
+    return failures;
+}
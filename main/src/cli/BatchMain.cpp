@@ -0,0 +1,75 @@
+/**
+ * @brief Entry point of the calcbatch command line evaluator.
+ *
+ * @details Reads newline separated expressions or equations from a file or
+ * stdin, solves them on a pool of threads and streams the results to stdout
+ * in input order. See BatchEvaluator for the output format.
+ *
+ * usage: calcbatch [--threads <n>] [--steps] [--timing] [--window <lines>] [file]
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "../../include/cli/BatchEvaluator.h"
+
+namespace {
+    void usage() {
+        std::cerr << "usage: calcbatch [--threads <n>] [--steps] [--timing] [--window <lines>] [file]\n"
+                  << "  reads one expression or equation per line from file, or stdin if it is - or missing\n";
+    }
+}
+
+int main(int argc, char *argv[]) {
+    BatchEvaluator::Options options{};
+    options.threads = std::thread::hardware_concurrency();
+    options.window = 0;
+    std::string path = "-";
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            options.threads = std::atoi(argv[++i]);
+        } else if (arg == "--window" && i + 1 < argc) {
+            options.window = std::atol(argv[++i]);
+        } else if (arg == "--steps") {
+            options.steps = true;
+        } else if (arg == "--timing") {
+            options.timing = true;
+        } else if (arg == "--help" || (arg.size() > 1 && arg[0] == '-' && arg != "-")) {
+            usage();
+            return arg == "--help" ? 0 : 1;
+        } else {
+            path = arg;
+        }
+    }
+
+    // keep enough lines in flight that a slow line does not stall the other threads
+    if (options.window == 0) {
+        options.window = 256 * (options.threads > 0 ? options.threads : 1);
+    }
+
+    std::ios::sync_with_stdio(false);
+    BatchEvaluator evaluator(options);
+
+    std::size_t failures;
+    if (path == "-") {
+        failures = evaluator.run(std::cin, std::cout);
+    } else {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "calcbatch: cannot open " << path << "\n";
+            return 1;
+        }
+        failures = evaluator.run(file, std::cout);
+    }
+
+    // failed lines are reported in the output, the exit status only tells that there were some
+    return failures > 0 ? 2 : 0;
+}
@@ -96,3 +96,18 @@ double ButtonResponder::solveGraphButtonResponse(std::string function, std::stri
         throw std::runtime_error(e.what());
     }
 }
+
+/**
+ * @brief response to get all the y values to graph
+ * @param function the function to use to compute the values
+ * @param inputs the x values (inputs to function)
+ * @return the y values from function(input) for each input
+ */
+std::vector<double> ButtonResponder::solveGraphButtonResponse(std::string function, const std::vector<double> &inputs) {
+    try {
+        Compute *c = new ComputeFunction();
+        return c->solve(function, inputs);
+    } catch (std::exception &e) {
+        throw std::runtime_error(e.what());
+    }
+}
@@ -0,0 +1,239 @@
+/**
+ * @file CalcCore.cpp
+ * @author Mihir Kadiya
+ * @brief the public interface of the calccore library
+ * @details Solves equations, systems of linear equations, functions, matrices
+ * and sets without any GUI. This is the only header a program linking
+ * libcalccore needs, it does not depend on Qt. Errors are thrown as
+ * std::runtime_error with a message for the user.
+ * @version 1.0
+ */
+
+#include <memory>
+#include <stdexcept>
+
+#include "../../../include/controller/compute/CalcCore.h"
+#include "../../../include/controller/compute/ComputeEquation.h"
+#include "../../../include/controller/compute/ComputeSysOfLinearEqn.h"
+#include "../../../include/controller/compute/ComputeMatrix.h"
+#include "../../../include/model/analyser/CompiledExpression.h"
+#include "../../../include/model/matrices/IterativeSolver.h"
+#include "../../../include/model/matrices/MappedMatrix.h"
+#include "../../../include/model/matrices/MatrixFile.h"
+#include "../../../include/model/sets/Sets.h"
+
+namespace {
+    /**
+     * @brief translate the options of the public interface to those of the solver
+     * @param options the options given to CalcCore
+     * @return the same options for IterativeSolver
+     */
+    IterativeSolver::Options solverOptions(const CalcCore::IterativeOptions &options) {
+        IterativeSolver::Options result;
+        switch (options.method) {
+            case CalcCore::IterativeOptions::Method::ConjugateGradient:
+                result.method = IterativeSolver::Method::ConjugateGradient;
+                break;
+            case CalcCore::IterativeOptions::Method::BiCGSTAB:
+                result.method = IterativeSolver::Method::BiCGSTAB;
+                break;
+            case CalcCore::IterativeOptions::Method::GMRES:
+                result.method = IterativeSolver::Method::GMRES;
+                break;
+        }
+        switch (options.preconditioner) {
+            case CalcCore::IterativeOptions::Preconditioner::None:
+                result.preconditioner = IterativeSolver::Preconditioner::None;
+                break;
+            case CalcCore::IterativeOptions::Preconditioner::Jacobi:
+                result.preconditioner = IterativeSolver::Preconditioner::Jacobi;
+                break;
+            case CalcCore::IterativeOptions::Preconditioner::ILU0:
+                result.preconditioner = IterativeSolver::Preconditioner::ILU0;
+                break;
+        }
+        result.tolerance = options.tolerance;
+        result.maxIterations = options.maxIterations;
+        result.restart = options.restart;
+        return result;
+    }
+}
+
+/**
+ * @brief solve an equation or expression step by step
+ * @param equation the equation to solve
+ * @return the steps of the solution, the last one is the answer
+ */
+std::vector<std::string> CalcCore::solveEquation(const std::string &equation) {
+    ComputeEquation compute;
+    return compute.solve(equation);
+}
+
+/**
+ * @brief solve a system of linear equations
+ * @param equations the equations of the system
+ * @return the solutions to the system, one line per variable
+ */
+std::vector<std::string> CalcCore::solveSysOfLinearEqn(const std::vector<std::string> &equations) {
+    ComputeSysOfLinearEqn compute;
+    return compute.solve(equations);
+}
+
+/**
+ * @brief solve a system of linear equations, trying an iterative solver first
+ * @details square systems with a unique solution are solved with the Krylov method in options,
+ * the others, or ones where it does not converge, are solved by elimination
+ * @param equations the equations of the system
+ * @param options the method, preconditioner, tolerance and iteration limits
+ * @return the solutions to the system, one line per variable
+ */
+std::vector<std::string> CalcCore::solveSysOfLinearEqn(const std::vector<std::string> &equations,
+                                                       const IterativeOptions &options) {
+    ComputeSysOfLinearEqn compute(solverOptions(options));
+    return compute.solve(equations);
+}
+
+/**
+ * @brief solve a system of linear equations for many sets of constants
+ * @details the coefficients are factored once and kept, so each set of constants, and later
+ * calls with the same coefficients, only cost substitution
+ * @param equations the equations of the system, their own constants are ignored
+ * @param constants the sets of constants, each with one value per equation
+ * @return the solutions for each set of constants, one line per variable
+ */
+std::vector<std::vector<std::string>> CalcCore::solveSysOfLinearEqn(const std::vector<std::string> &equations,
+                                                                    const std::vector<std::vector<double>> &constants) {
+    ComputeSysOfLinearEqn compute;
+    return compute.solve(equations, constants);
+}
+
+/**
+ * @brief solve a system of linear equations without rounding
+ * @details the coefficients are taken as the fractions they stand for and the answers are
+ * given as fractions, systems whose values outgrow 64 bit integers are solved with doubles
+ * @param equations the equations of the system
+ * @return the solutions to the system, one line per variable
+ */
+std::vector<std::string> CalcCore::solveSysOfLinearEqnExactly(const std::vector<std::string> &equations) {
+    ComputeSysOfLinearEqn compute(ComputeSysOfLinearEqn::Arithmetic::Exact);
+    return compute.solve(equations);
+}
+
+/**
+ * @brief limit the memory kept for the factors of recently solved systems
+ * @details the factors are kept so that systems with the same coefficients only cost
+ * substitution, the least recently used ones are dropped to stay within the limit
+ * @param values the number of doubles the cache may hold, 8 bytes each, 0 keeps nothing
+ */
+void CalcCore::setFactorizationCacheSize(std::size_t values) {
+    ComputeSysOfLinearEqn::factorizations().setMaxValues(values);
+}
+
+/**
+ * @brief drop the factors of every recently solved system
+ */
+void CalcCore::clearFactorizationCache() {
+    ComputeSysOfLinearEqn::factorizations().clear();
+}
+
+/**
+ * @brief evaluate a function at one input, every variable is bound to the input
+ * @param function the function to evaluate
+ * @param input the x value
+ * @return the y value
+ */
+double CalcCore::evaluate(const std::string &function, double input) {
+    CompiledExpression expression(function);
+    return expression.evaluate(input);
+}
+
+/**
+ * @brief evaluate a function at many inputs, the function is only parsed once
+ * @param function the function to evaluate
+ * @param inputs the x values
+ * @return the y value for each input
+ */
+std::vector<double> CalcCore::evaluate(const std::string &function, const std::vector<double> &inputs) {
+    CompiledExpression expression(function);
+    std::vector<double> outputs(inputs.size());
+    expression.evaluateBatch(inputs.data(), outputs.data(), inputs.size());
+    return outputs;
+}
+
+/**
+ * @brief perform operations on two matrices, see ComputeMatrix::solve
+ * @param matrix1 the values of the first matrix
+ * @param matrix2 the values of the second matrix
+ * @param operations the unary operation on matrix1, the binary operation and the unary operation on matrix2
+ * @param scalar1 scalar to multiply matrix1 by
+ * @param scalar2 scalar to multiply matrix2 by
+ * @return the resulting matrix, 1x1 if the result is a number
+ */
+std::vector<std::vector<double>> CalcCore::solveMatrix(const std::vector<std::vector<double>> &matrix1,
+                                                       const std::vector<std::vector<double>> &matrix2,
+                                                       const char operations[3], double scalar1, double scalar2) {
+    std::vector<std::vector<double>> second = matrix2;
+    char ops[3] = {operations[0], operations[1], operations[2]};
+    ComputeMatrix compute;
+    return compute.solve(matrix1, second, ops, scalar1, scalar2);
+}
+
+/**
+ * @brief perform operations on two matrices stored in files, see ComputeMatrix::solve
+ * @details files ending in .csv are parsed, any other file is read as a binary matrix file
+ * and memory-mapped, so its values are not copied unless an operation needs to
+ * @param path1 the file with the first matrix
+ * @param path2 the file with the second matrix
+ * @param operations the unary operation on matrix1, the binary operation and the unary operation on matrix2
+ * @param scalar1 scalar to multiply matrix1 by
+ * @param scalar2 scalar to multiply matrix2 by
+ * @param outputPath the binary matrix file to write the result to, 1x1 if the result is a number
+ */
+void CalcCore::solveMatrixFiles(const std::string &path1, const std::string &path2, const char operations[3],
+                                double scalar1, double scalar2, const std::string &outputPath) {
+    auto isCsv = [](const std::string &path) {
+        return path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+    };
+
+    // CSV operands are parsed into these, binary ones are viewed through the mappings
+    Matrix csv1(0, 0), csv2(0, 0);
+    std::unique_ptr<MappedMatrix> mapped1, mapped2;
+    ConstMatrixView first = csv1.view();
+    ConstMatrixView second = csv2.view();
+    if (isCsv(path1)) {
+        csv1 = MatrixFile::readCsv(path1);
+        first = csv1.view();
+    } else {
+        mapped1 = std::make_unique<MappedMatrix>(path1);
+        first = mapped1->view();
+    }
+    if (isCsv(path2)) {
+        csv2 = MatrixFile::readCsv(path2);
+        second = csv2.view();
+    } else {
+        mapped2 = std::make_unique<MappedMatrix>(path2);
+        second = mapped2->view();
+    }
+
+    ComputeMatrix compute;
+    MatrixFile::write(outputPath, compute.solve(first, second, operations, scalar1, scalar2).view());
+}
+
+/**
+ * @brief perform a set operation
+ * @param set1 the first set
+ * @param set2 the second set
+ * @param operation 'u' for union, 'n' for intersection or '-' for subtraction
+ * @return the resulting set
+ */
+std::vector<double> CalcCore::solveSet(const std::vector<double> &set1, const std::vector<double> &set2,
+                                       char operation) {
+    if (operation == 'u') {
+        return Sets::Union(set1, set2);
+    } else if (operation == 'n') {
+        return Sets::intersection(set1, set2);
+    } else if (operation == '-') {
+        return Sets::Subtraction(set1, set2);
+    }
+    throw std::runtime_error("Unknown set operation");
+}
@@ -12,6 +12,7 @@
 #include "../../../include/model/analyser/Interpreter.h"
 #include "../../../include/model/analyser/Parser.h"
 #include "../../../include/model/analyser/Lexer.h"
+#include "../../../include/model/analyser/ParseSession.h"
 
 /**
  * @brief implements an algorithm to solve a mathematical equation
@@ -21,6 +22,9 @@
  */
 std::vector<std::string> ComputeEquation::solve(const std::string& equation) const{
     try {
+        // the tree and its functions are released when the session closes
+        ParseSession session;
+
         Lexer lexer(equation);
         Parser parser = Parser();
         parser.createParseTree(lexer.tokenizer());
@@ -7,9 +7,7 @@
  */
 
 #include "../../../include/controller/compute/ComputeFunction.h"
-#include "../../../include/model/analyser/Interpreter.h"
-#include "../../../include/model/analyser/Lexer.h"
-#include "../../../include/model/analyser/Parser.h"
+#include "../../../include/model/analyser/CompiledExpression.h"
 
 /**
  * @brief gets a y value by computing a function at an input
@@ -19,22 +17,29 @@
  */
 double ComputeFunction::solve(const std::string& function, const std::string& input) {
     try {
-        Lexer lexer(function);
-        std::vector<Token> tokens = lexer.tokenizer();
+        CompiledExpression expression(function);
 
-        // substitute every variable token with a number token of value "input"
-        for (Token &token: tokens) {
-            if (token.getType() == Token::Type::Variable) {
-                token = Token(Token::Type::Number, input, -1);
-            }
-        }
+        // every variable is bound to the value of "input"
+        return expression.evaluate(std::stod(input, nullptr));
+    } catch (std::exception &e) {
+        throw std::runtime_error(e.what());
+    }
+}
 
-        Parser parser = Parser();
-        parser.createParseTree(tokens);
+/**
+ * @brief gets the y values of a function at many inputs, the function is only parsed once
+ * @param function the function the use to compute the y values
+ * @param inputs the x values (inputs to function)
+ * @return the y values from function(input) for each input
+ */
+std::vector<double> ComputeFunction::solve(const std::string& function, const std::vector<double>& inputs) {
+    try {
+        CompiledExpression expression(function);
 
-        Interpreter interpreter = Interpreter(parser.getRoot());
-        return interpreter.solve();
-    } catch (exception &e) {
+        std::vector<double> outputs(inputs.size());
+        expression.evaluateBatch(inputs.data(), outputs.data(), inputs.size());
+        return outputs;
+    } catch (std::exception &e) {
         throw std::runtime_error(e.what());
     }
 }
@@ -7,10 +7,71 @@
  */
 
 #include "../../../include/controller/compute/ComputeMatrix.h"
+#include "../../../include/model/matrices/FixedMatrix.h"
+#include "../../../include/model/matrices/LUDecomposition.h"
+#include "../../../include/model/matrices/MatrixMultiply.h"
+
+namespace {
+    /**
+     * pass make the values of a matrix, transposed or not, as a lazy expression
+     */
+    template <typename F>
+    Matrix withTranspose(ConstMatrixView matrix, bool transpose, F &&make) {
+        if (transpose)
+            return make(transposed(lazy(matrix)));
+        return make(lazy(matrix));
+    }
+
+    Matrix numberResult(double value) {
+        Matrix res(1, 1);
+        res(0, 0) = value;
+        return res;
+    }
+
+    Matrix inverse(ConstMatrixView matrix) {
+        if (!matrix.isSquare())
+            throw std::runtime_error("can not compute inverse of non square matrix");
+        LUDecomposition lu(matrix);
+        if (lu.isSingular())
+            throw std::runtime_error("The inverse does not exist for this matrix");
+        return lu.inverse();
+    }
+
+    double determinant(ConstMatrixView matrix) {
+        if (!matrix.isSquare())
+            throw std::runtime_error("can not compute determinant of non square matrix");
+        return LUDecomposition(matrix).determinant();
+    }
+
+    /**
+     * the operations on two N x N matrices with FixedMatrix, nothing is allocated but the result
+     */
+    template <int N>
+    Matrix solveFixed(ConstMatrixView matrix1, ConstMatrixView matrix2, const char operations[3],
+                      double scalar1, double scalar2) {
+        FixedMatrix<N, N> first(matrix1);
+        FixedMatrix<N, N> second(matrix2);
+        if (operations[0] == 'I')
+            first = first.inverse();
+        if (operations[0] == 'T')
+            first = first.transpose();
+        if (operations[2] == 'I')
+            second = second.inverse();
+        if (operations[2] == 'T')
+            second = second.transpose();
+
+        if (operations[1] == '+')
+            return (first * scalar1 + second * scalar2).toMatrix();
+        if (operations[1] == '-')
+            return (first * scalar1 - second * scalar2).toMatrix();
+        return (first * (scalar1 * scalar2) * second).toMatrix();
+    }
+}
 
 /**
  * @brief performs specified operations on two matrices
- * 
+ * @details see the overload taking views, which does the work
+ *
  * @param matrix1 2d vector of doubles containing the values of the first matrix
  * @param matrix2 2d vector of doubles containing the values of the second matrix
  * @param operations operations[0] is the unary operation to perform on matrix1. 'I', 'T', 'D', or NULL 
@@ -22,109 +83,143 @@
  */
 std::vector<std::vector<double>> ComputeMatrix::solve(const std::vector<std::vector<double>>& matrix1, std::vector<std::vector<double>>& matrix2,
                     char operations[3], double scalar1, double scalar2) const{
+    Matrix first_matrix(matrix1);
+    Matrix second_matrix(matrix2);
+    return solve(first_matrix.view(), second_matrix.view(), operations, scalar1, scalar2).getValues();
+}
+
+/**
+ * @brief performs specified operations on two matrices
+ * @details transposing, scaling, adding and subtracting are combined into one lazy expression
+ * that is computed in a single pass. Only an inverse or a product creates an intermediate Matrix.
+ * The operands are only read, so they can be views of a MappedMatrix
+ *
+ * @param matrix1 the values of the first matrix
+ * @param matrix2 the values of the second matrix
+ * @param operations operations[0] is the unary operation to perform on matrix1. 'I', 'T', 'D', or NULL 
+ *                   operations[1] is the operation between matrix1 and matrix2. '+', '-', or '*' 
+ *                   operations[2] is the unary operation to perform on matrix2. 'I', 'T', 'D', or NULL 
+ * @param scalar1 scalar to multiply matrix1 by
+ * @param scalar2 scalar to multiply matrix2 by
+ * @return the matrix obtained after performing the operations, 1x1 if the result is a number
+ */
+Matrix ComputeMatrix::solve(ConstMatrixView matrix1, ConstMatrixView matrix2, const char operations[3],
+                            double scalar1, double scalar2) const {
+    // two matrices of the sizes the GUI allows go through the unrolled fixed size code,
+    // a determinant turns an operand into a number and takes the general path
+    if (matrix1.isSquare() && matrix2.isSquare() && matrix1.rows() == matrix2.rows()
+            && operations[0] != 'D' && operations[2] != 'D') {
+        switch (matrix1.rows()) {
+            case 2:
+                return solveFixed<2>(matrix1, matrix2, operations, scalar1, scalar2);
+            case 3:
+                return solveFixed<3>(matrix1, matrix2, operations, scalar1, scalar2);
+            case 4:
+                return solveFixed<4>(matrix1, matrix2, operations, scalar1, scalar2);
+        }
+    }
 
-    auto *first_matrix = new Matrix(matrix1);
-    auto *second_matrix = new Matrix(matrix2);
-    double first_matrix_value;  //may be assigned value of determinant of first matrix
-    double second_matrix_value; //may be assigned value of determinant of first matrix
-    double numeric_result;  
+    ConstMatrixView first_matrix = matrix1;
+    ConstMatrixView second_matrix = matrix2;
+    Matrix first_inverse(0, 0);     //holds the inverse that first_matrix then views
+    Matrix second_inverse(0, 0);
+    bool first_is_matrix = true;    //false once the matrix has been reduced to its determinant
+    bool second_is_matrix = true;
+    bool first_transposed = false;  //transposing is done lazily by the connecting operation
+    bool second_transposed = false;
+    double first_matrix_value = 0;  //may be assigned value of determinant of first matrix
+    double second_matrix_value = 0; //may be assigned value of determinant of first matrix
 
     //Perform unimatrix operations on first matrix
     if(operations[0] == 'I') {
-        *first_matrix = first_matrix->inverse();
+        first_inverse = inverse(first_matrix);
+        first_matrix = first_inverse.view();
     }
     if(operations[0] == 'T') {
-        *first_matrix = first_matrix->inverse();
+        first_transposed = true;
     }
     if(operations[0] == 'D') {
-        first_matrix_value = first_matrix->determinant();
-        first_matrix = nullptr;    //set matrix to nullptr to represent it has been reduced to its determinant
+        first_matrix_value = determinant(first_matrix) * scalar1;
+        first_is_matrix = false;
     }
 
-    if(first_matrix)
-        *first_matrix = first_matrix->scalarMulitply(scalar1);
-    else
-        first_matrix_value = first_matrix_value*scalar1;
-
     //Perform unimatrix operations on second matrix
     if(operations[2] == 'I') {
-        *second_matrix = second_matrix->inverse();
+        second_inverse = inverse(second_matrix);
+        second_matrix = second_inverse.view();
     }
     if(operations[2] == 'T') {
-        *second_matrix = second_matrix->inverse();
+        second_transposed = true;
     }
     if(operations[2] == 'D'){
-        second_matrix_value = second_matrix->determinant();
-        second_matrix = nullptr;    //set matrix to nullptr to represent it has been reduced to its determinant
+        second_matrix_value = determinant(second_matrix) * scalar2;
+        second_is_matrix = false;
     }
 
-    if(second_matrix)
-        *second_matrix = second_matrix->scalarMulitply(scalar2);
-    else
-        second_matrix_value = second_matrix_value*scalar2;
-
-    
     //Perform connecting operation
     if(operations[1] == '+'){
-        if(!first_matrix){
-            if(!second_matrix) {
-                numeric_result = first_matrix_value + second_matrix_value;
-                std::vector<std::vector<double>> res(1, std::vector<double>(1));
-                res[0][0] = numeric_result;
-                return res;
-            }
-            else {
+        if(!first_is_matrix){
+            if(!second_is_matrix)
+                return numberResult(first_matrix_value + second_matrix_value);
+            else
                 throw std::runtime_error("Error. Cannot add matrix to number");
-            }
         }else{
-            if(!second_matrix)
+            if(!second_is_matrix)
                 throw std::runtime_error("Error. Cannot add number to matrix");
-            else {
-                Matrix res = *first_matrix + *second_matrix;
-                return res.getValues();
-            }
+            return withTranspose(first_matrix, first_transposed, [&](const auto &first) {
+                return withTranspose(second_matrix, second_transposed, [&](const auto &second) {
+                    return evaluate(scaled(first, scalar1) + scaled(second, scalar2));
+                });
+            });
         }
     }else if(operations[1] == '-'){
-        if(!first_matrix){
-            if(!second_matrix) {
-                numeric_result = first_matrix_value - second_matrix_value;
-                std::vector<std::vector<double>> res(1, std::vector<double>(1));
-                res[0][0] = numeric_result;
-                return res;
-            }
-            else {
+        if(!first_is_matrix){
+            if(!second_is_matrix)
+                return numberResult(first_matrix_value - second_matrix_value);
+            else
                 throw std::runtime_error("Error. Cannot subtract number from matrix");
-            }
         }else{
-            if(!second_matrix)
+            if(!second_is_matrix)
                 throw std::runtime_error("Error. Cannot subtract matrix from number");
-            else {
-                Matrix res = *first_matrix - *second_matrix;
-                return res.getValues();
-            }
+            return withTranspose(first_matrix, first_transposed, [&](const auto &first) {
+                return withTranspose(second_matrix, second_transposed, [&](const auto &second) {
+                    return evaluate(scaled(first, scalar1) - scaled(second, scalar2));
+                });
+            });
         }
     }else{  //Multiplying
-        if(!first_matrix){
-            if(!second_matrix) {
-                numeric_result = first_matrix_value * second_matrix_value;
-                std::vector<std::vector<double>> res(1, std::vector<double>(1));
-                res[0][0] = numeric_result;
-                return res;
-            }
-            else {
-                Matrix res = second_matrix->scalarMulitply(first_matrix_value);;
-                return res.getValues();
-            }
+        if(!first_is_matrix){
+            if(!second_is_matrix)
+                return numberResult(first_matrix_value * second_matrix_value);
+            return withTranspose(second_matrix, second_transposed, [&](const auto &second) {
+                return evaluate(scaled(second, scalar2 * first_matrix_value));
+            });
         }else {
-            if(!second_matrix) {
-                Matrix res = first_matrix->scalarMulitply(second_matrix_value);
-                return res.getValues();
+            if(!second_is_matrix) {
+                return withTranspose(first_matrix, first_transposed, [&](const auto &first) {
+                    return evaluate(scaled(first, scalar1 * second_matrix_value));
+                });
             }
-            else {
-                Matrix res = *first_matrix * *second_matrix;
-                return res.getValues();
+            // A product reads its operands many times, so they are materialised first.
+            // Both scalars go into the left operand, which is only copied if it has to be
+            double scalar = scalar1 * scalar2;
+            Matrix first_copy(0, 0);
+            Matrix second_copy(0, 0);
+            if (first_transposed || scalar != 1) {
+                first_copy = withTranspose(first_matrix, first_transposed, [&](const auto &first) {
+                    return evaluate(scaled(first, scalar));
+                });
+                first_matrix = first_copy.view();
             }
+            if (second_transposed) {
+                second_copy = evaluate(transposed(lazy(second_matrix)));
+                second_matrix = second_copy.view();
+            }
+            if (first_matrix.cols() != second_matrix.rows())
+                throw std::runtime_error("matrix dimensions are incompatable for this operation");
+            Matrix product(first_matrix.rows(), second_matrix.cols());
+            MatrixMultiply::multiply(first_matrix, second_matrix, product.view());
+            return product;
         }
     }
 }
-
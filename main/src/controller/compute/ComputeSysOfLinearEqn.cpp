@@ -10,128 +10,604 @@
 #include "../../../include/controller/compute/ComputeSysOfLinearEqn.h"
 #include "../../../include/model/analyser/Lexer.h"
 #include "../../../include/model/analyser/Parser.h"
-#include "../../../include/model/analyser/Interpreter.h"
+#include "../../../include/model/analyser/LinearSystem.h"
+#include "../../../include/model/analyser/ParseSession.h"
+#include "../../../include/model/matrices/ExactMatrix.h"
+#include "../../../include/model/matrices/FactorizationCache.h"
+#include "../../../include/model/matrices/QRDecomposition.h"
+#include "../../../include/model/matrices/SparseMatrix.h"
+#include "../../../include/model/utilities/Utilities.h"
+#include "../../../include/model/utilities/WorkerPool.h"
 #include <iostream>
+#include <limits>
+#include <mutex>
 
-/**
- * @brief function to take a set of linear equations and get solutions to the system of linear equations
- * @param equations the equations of the system
- * @return the solutions to the system of linear equations
- */
-std::vector<std::string> ComputeSysOfLinearEqn::solve(const std::vector<std::string>& equations) const {
-    try {
-        std::vector<Node *> trees;
-        for (const std::string &equation: equations) {
-            Lexer lexer(equation);
-            Parser parser = Parser();
-            parser.createParseTree(lexer.tokenizer());
-            trees.push_back(parser.getRoot());
-        }
+namespace {
+    // systems with at least this many coefficients (unknowns + 1 times equations) may be reduced in sparse form
+    const int sparseMinimumSize = 1024;
 
-        Interpreter interpreter(trees);
+    // the largest fraction of non-zero coefficients that is reduced in sparse form
+    const double sparseDensity = 0.1;
 
-        std::vector<char> variable_names = interpreter.getVariableNames();
-        //Create list of possible parameter names (alphabet - elements of variable_names)
-        std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
-        std::vector<char> possible_parameter_names;
-        for (char c: alphabet) {
-            if (!(std::find(variable_names.begin(), variable_names.end(), c) != variable_names.end()))
-                possible_parameter_names.push_back(c);
-        }
+    // inconsistent systems are fitted with a dense QR of at most this many values (32 MB),
+    // larger ones are only reported as inconsistent
+    const long leastSquaresMaximumSize = 1L << 22;
 
-        std::vector<int> basic_var_indeces;
-        std::vector<std::string> output;
+    // systems with at least this many equations are parsed on a pool of threads
+    const size_t parallelEquations = 256;
+
+    /**
+     * parse the equations and collect them into a linear system, in their order
+     * @details every equation is independent until the matrix is assembled, so large
+     * systems are split into one contiguous part per thread of the shared pool, each with its own session
+     * @param equations the equations of the system
+     * @return the system
+     */
+    LinearSystem parseEquations(const std::vector<std::string> &equations) {
+        WorkerPool::Claim claim(equations.size() >= parallelEquations);
+        WorkerPool &pool = claim.pool();
+
+        // the system of each part by its first equation, and the first equation that failed
+        std::map<int, LinearSystem> parts;
+        size_t failed = equations.size();
+        std::string error;
+        std::mutex mutex;
 
-        // Get 2D vector representing RREF of the system of linear equations
-        Matrix augmented_matrix = Matrix(interpreter.getAugmentedMatrix());
-        augmented_matrix.reduceToRREF();
-        std::vector<std::vector<double>> solution_matrix = augmented_matrix.getValues();
-
-        // Check for system inconsistency
-        bool all_coefficients_0;
-        for (int i = 0; i < solution_matrix.size(); i++) {
-            all_coefficients_0 = true;
-            for (int j = 0; j < solution_matrix[0].size() - 1; j++) {
-                if (solution_matrix[i][j] != 0) {
-                    all_coefficients_0 = false;
-                    break;
+        pool.run(0, equations.size(), [&](int begin, int end) {
+            // the trees and their functions are released when the session closes
+            ParseSession session;
+            LinearSystem part;
+            for (int i = begin; i < end; i++) {
+                try {
+                    Lexer lexer(equations[i]);
+                    Parser parser = Parser();
+                    parser.createParseTree(lexer.tokenizer());
+                    part.addEquation(parser.getRoot());
+                } catch (std::exception &e) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if ((size_t) i < failed) {
+                        failed = i;
+                        error = e.what();
+                    }
+                    return;
                 }
             }
-            if (all_coefficients_0 && solution_matrix[i][solution_matrix[0].size() - 1]) {
-                // System is inconsistent
-                output.push_back("There are no solutions for the given system");
-                return output;
-            }
+            std::lock_guard<std::mutex> lock(mutex);
+            parts.emplace(begin, std::move(part));
+        });
+
+        if (failed < equations.size()) {
+            throw std::runtime_error("Equation " + std::to_string(failed + 1) + " (" + equations[failed] + "): "
+                                     + error);
+        }
+        LinearSystem system;
+        for (const std::pair<const int, LinearSystem> &part: parts)
+            system.append(part.second);
+        return system;
+    }
+
+    // a row of the reduced system, formatted but not yet written out
+    struct ReducedRow {
+        // the column of the leading 1, -1 for a row of zeros
+        int leading = -1;
+        // the coefficients of the variables, negated as they are moved to the right hand side
+        std::vector<std::pair<int, std::string>> terms;
+        std::string constant;
+    };
+
+    /**
+     * @brief choose names for the parameters of the free variables
+     * @details letters that are not variables are used first, from the back of the alphabet,
+     * then t1, t2, ... skipping any that are variables
+     * @param variable_names the variable of each column
+     * @param count the number of names needed
+     * @return the names in the order they should be given out
+     */
+    std::vector<std::string> parameterNames(const std::vector<std::string> &variable_names, int count) {
+        std::vector<std::string> names;
+        for (char c = 'z'; c >= 'a' && (int) names.size() < count; c--) {
+            std::string name(1, c);
+            if (std::find(variable_names.begin(), variable_names.end(), name) == variable_names.end())
+                names.push_back(name);
         }
+        for (int i = 1; (int) names.size() < count; i++) {
+            std::string name = "t" + std::to_string(i);
+            if (std::find(variable_names.begin(), variable_names.end(), name) == variable_names.end())
+                names.push_back(name);
+        }
+        return names;
+    }
+
+    /**
+     * @brief write each variable in terms of the parameters given by the free columns
+     * @param rows the rows of the RREF of a consistent system
+     * @param variable_names the variable of each column
+     * @return one line per variable
+     */
+    std::vector<std::string> formatSolution(const std::vector<ReducedRow> &rows,
+                                            const std::vector<std::string> &variable_names) {
+        int constant_col = variable_names.size();
 
-        // System is consistent
         // Find which columns/variables to parameterise
-        for (int i = 0; i < solution_matrix.size(); i++) {
-            //for each row find the leading 1. record the row and column of the leading 1
-            for (int j = 0; j < solution_matrix[0].size() - 1; j++) {
-                if (solution_matrix[i][j] == 1) {
-                    basic_var_indeces.push_back(j);
-                    break;
-                }
+        std::vector<bool> is_basic(constant_col, false);
+        int free_count = constant_col;
+        for (const ReducedRow &row: rows) {
+            if (row.leading >= 0 && !is_basic[row.leading]) {
+                is_basic[row.leading] = true;
+                free_count--;
             }
         }
 
         // Assign a parameter to appropriate variables
-        std::map<int, char> parameters;
-        for (int i = 0; i < solution_matrix[0].size() - 1; i++) {
+        std::vector<std::string> possible_parameter_names = parameterNames(variable_names, free_count);
+        std::vector<std::string> parameters(constant_col);
+        for (int i = 0, next = 0; i < constant_col; i++) {
             // Does current column represent a variable to be parameterised
-            if (!(std::find(basic_var_indeces.begin(), basic_var_indeces.end(), i) != basic_var_indeces.end())) {
-                // Map column number to parameter name
-                parameters.insert(std::pair<int, char>(i, possible_parameter_names.back()));
-                possible_parameter_names.pop_back();
-            }
+            if (!is_basic[i])
+                parameters[i] = possible_parameter_names[next++];
         }
 
         // For each column get the variable it represets in terms of params
+        std::vector<std::string> output;
         std::string current_line;
-        std::string coeff;
-        std::string constant;
-        int position = 0;
         int which_row = 0;
-        int which_param;
-        for (int i = 0; i < solution_matrix[0].size() - 1; i++) {
-            current_line = "";
+        for (int i = 0; i < constant_col; i++) {
+            current_line = variable_names[i];
+            current_line.append(" = ");
             //Is the current column representing a non free variable
-            if (std::find(basic_var_indeces.begin(), basic_var_indeces.end(), i) != basic_var_indeces.end()) {
-                which_param = 0;
-                current_line.push_back(variable_names[i]);
-                current_line.append(" = ");
-
-                for (int j = i + 1; j < solution_matrix[0].size() - 1; j++) {
-                    if (solution_matrix[which_row][j] != 0) {
+            if (is_basic[i]) {
+                for (const std::pair<int, std::string> &term: rows[which_row].terms) {
+                    if (term.first > i) {
                         // Construct current_line
-                        coeff = std::to_string(-solution_matrix[which_row][j]);
-                        coeff.erase(coeff.find_last_not_of('0') + 1, std::string::npos);
-                        if (coeff.back() == '.') coeff.pop_back();
-                        if (coeff != "1")
-                            current_line.append(coeff);
-                        current_line.push_back(parameters[j]);
+                        if (term.second != "1")
+                            current_line.append(term.second);
+                        current_line.append(parameters[term.first]);
                         current_line.append(" + ");
-                        which_param++;
                     }
                 }
-                constant = std::to_string(solution_matrix[which_row].back());
-                constant.erase(constant.find_last_not_of('0') + 1, std::string::npos);
-                if (constant.back() == '.') constant.pop_back();
-                if (constant != "0")
-                    current_line.append(constant);  ///append the constant
+                if (rows[which_row].constant != "0")
+                    current_line.append(rows[which_row].constant);  ///append the constant
                 which_row++;
             } else {
-                current_line.push_back(variable_names[i]);
-                current_line.append(" = ");
-                current_line.push_back(parameters[i]);
+                current_line.append(parameters[i]);
             }
             output.push_back(current_line);
         }
         return output;
+    }
+
+    /**
+     * @brief write a unique solution the way elimination would
+     * @param x the value of each variable
+     * @param variable_names the variable of each column
+     * @return one line per variable
+     */
+    std::vector<std::string> formatUnique(const std::vector<double> &x, const std::vector<std::string> &variable_names) {
+        std::vector<ReducedRow> rows(variable_names.size());
+        for (int i = 0; i < (int) rows.size(); i++) {
+            rows[i].leading = i;
+            rows[i].constant = Utilities::removeTrailingZeros(x[i]);
+            if (rows[i].constant == "-0")
+                rows[i].constant = "0";
+        }
+        return formatSolution(rows, variable_names);
+    }
+
+    /**
+     * @brief write the least squares fit of an inconsistent system
+     * @param x the value of each variable
+     * @param residual_norm the norm of the differences between the two sides of the equations
+     * @param variable_names the variable of each column
+     * @return a note, one line per variable and the residual norm
+     */
+    std::vector<std::string> formatLeastSquares(const std::vector<double> &x, double residual_norm,
+                                                const std::vector<std::string> &variable_names) {
+        auto format = [](double value) {
+            std::string text = Utilities::removeTrailingZeros(value);
+            return text == "-0" ? std::string("0") : text;
+        };
+        std::vector<std::string> output;
+        output.push_back("There are no solutions for the given system, the least squares fit is");
+        for (int i = 0; i < (int) variable_names.size(); i++)
+            output.push_back(variable_names[i] + " = " + format(x[i]));
+        output.push_back("residual norm = " + format(residual_norm));
+        return output;
+    }
+
+    /**
+     * @brief check if a system is large and sparse enough to be reduced in sparse form
+     * @param augmented_matrix the coefficients, with the constants in the last column
+     * @return true if elimination should work on the non-zeros only
+     */
+    bool isSparse(const SparseMatrix &augmented_matrix) {
+        return augmented_matrix.getRows() * augmented_matrix.getCols() >= sparseMinimumSize
+               && augmented_matrix.density() <= sparseDensity;
+    }
+
+    /**
+     * @brief check if a square matrix has a pivot in every row of its RREF
+     * @details uses the same reduction, and so the same idea of zero, as the
+     * elimination a singular system falls back to
+     * @param coefficients the square matrix
+     * @return true if the matrix is nonsingular
+     */
+    bool isNonsingular(SparseMatrix coefficients) {
+        coefficients.reduceToRREF();
+        const std::vector<int> &row_start = coefficients.getRowStart();
+        for (int i = 0; i < coefficients.getRows(); i++) {
+            if (row_start[i + 1] == row_start[i])
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief replace the constants of a system
+     * @param augmented_matrix the coefficients, with the constants in the last column
+     * @param constants the new constant of each equation
+     * @return the same coefficients with the new constants
+     */
+    SparseMatrix withConstants(const SparseMatrix &augmented_matrix, const std::vector<double> &constants) {
+        const std::vector<int> &row_start = augmented_matrix.getRowStart();
+        const std::vector<int> &col_index = augmented_matrix.getColIndex();
+        const std::vector<double> &values = augmented_matrix.getValues();
+        int constant_col = augmented_matrix.getCols() - 1;
+
+        std::vector<SparseMatrix::Entry> entries;
+        entries.reserve(values.size() + constants.size());
+        for (int i = 0; i < augmented_matrix.getRows(); i++) {
+            for (int k = row_start[i]; k < row_start[i + 1]; k++) {
+                if (col_index[k] != constant_col)
+                    entries.push_back({i, col_index[k], values[k]});
+            }
+            entries.push_back({i, constant_col, constants[i]});
+        }
+        return SparseMatrix(augmented_matrix.getRows(), augmented_matrix.getCols(), entries);
+    }
+
+    /**
+     * @brief copy one column of a matrix
+     * @param matrix the matrix
+     * @param col the index of the column
+     * @return the values of the column, top to bottom
+     */
+    std::vector<double> column(const Matrix &matrix, int col) {
+        std::vector<double> values(matrix.getRows());
+        for (int row = 0; row < matrix.getRows(); row++)
+            values[row] = matrix(row, col);
+        return values;
+    }
+}
+
+/**
+ * @brief get the cache of the factors of recently solved coefficient matrices
+ * @return the cache, shared by every ComputeSysOfLinearEqn
+ */
+FactorizationCache &ComputeSysOfLinearEqn::factorizations() {
+    static FactorizationCache cache;
+    return cache;
+}
+
+/**
+ * @brief construct a compute class that tries an iterative solver before elimination
+ * @param options the Krylov method, preconditioner, tolerance and iteration limits to use
+ */
+ComputeSysOfLinearEqn::ComputeSysOfLinearEqn(const IterativeSolver::Options &options) {
+    iterative = true;
+    ComputeSysOfLinearEqn::options = options;
+}
+
+/**
+ * @brief construct a compute class that reduces in the given arithmetic
+ * @param arithmetic Exact to eliminate without rounding and give fractions, Floating for doubles
+ */
+ComputeSysOfLinearEqn::ComputeSysOfLinearEqn(Arithmetic arithmetic) {
+    ComputeSysOfLinearEqn::arithmetic = arithmetic;
+}
+
+/**
+ * @brief solve a square system with the iterative solver
+ * @details a singular system can converge to one of its many solutions, so a
+ * result is only kept once the coefficients are known to be nonsingular
+ * @param augmented_matrix the coefficients, with the constants in the last column
+ * @param variable_names the variable of each column
+ * @param output set to one line per variable if the solver converged
+ * @return true if the solver converged to the unique solution, false if elimination is needed
+ */
+bool ComputeSysOfLinearEqn::solveIteratively(const SparseMatrix &augmented_matrix, const std::vector<std::string> &variable_names,
+                                             std::vector<std::string> &output) const {
+    int n = augmented_matrix.getRows();
+    if (n == 0 || augmented_matrix.getCols() != n + 1)
+        return false;
+
+    const std::vector<int> &row_start = augmented_matrix.getRowStart();
+    const std::vector<int> &col_index = augmented_matrix.getColIndex();
+    const std::vector<double> &values = augmented_matrix.getValues();
+    std::vector<SparseMatrix::Entry> coefficients;
+    std::vector<double> constants(n);
+    for (int i = 0; i < n; i++) {
+        for (int k = row_start[i]; k < row_start[i + 1]; k++) {
+            if (col_index[k] < n)
+                coefficients.push_back({i, col_index[k], values[k]});
+            else
+                constants[i] = values[k];
+        }
+    }
+
+    SparseMatrix a(n, n, coefficients);
+    IterativeSolver::Result result;
+    try {
+        IterativeSolver solver(a);
+        result = solver.solve(constants, options);
+    } catch (std::exception &) {
+        // e.g. ILU(0) on a matrix with a zero on its diagonal
+        return false;
+    }
+    if (!result.converged || !isNonsingular(a))
+        return false;
+
+    for (int i = 0; i < n; i++) {
+        std::string current_line;
+        current_line.append(variable_names[i]);
+        current_line.append(" = ");
+        std::string constant = Utilities::removeTrailingZeros(result.x[i]);
+        if (constant != "0" && constant != "-0")
+            current_line.append(constant);
+        output.push_back(current_line);
+    }
+    return true;
+}
+
+/**
+ * @brief solve with the cached factors of the coefficients, for one or many sets of constants
+ * @details square systems are factored with LU and taller ones with QR, either way a
+ * set of constants only costs substitution once its coefficients are in the cache. A
+ * tall system whose fit leaves more than rounding error is given as a least squares fit.
+ * @param coefficients the coefficient of each variable in each equation
+ * @param constants the constants of the equations, one set per column
+ * @param variable_names the variable of each column of the coefficients
+ * @param outputs set to the solution for each set of constants
+ * @return true if solved, false if the coefficients are singular and elimination is needed
+ */
+bool ComputeSysOfLinearEqn::solveFactored(ConstMatrixView coefficients, ConstMatrixView constants,
+                                          const std::vector<std::string> &variable_names,
+                                          std::vector<std::vector<std::string>> &outputs) const {
+    FactorizationCache::Factors factors = factorizations().get(coefficients);
+    int m = coefficients.rows();
+    int count = constants.cols();
+
+    if (factors.lu && !factors.lu->isSingular()) {
+        Matrix solutions = factors.lu->solve(constants);
+        for (int j = 0; j < count; j++)
+            outputs.push_back(formatUnique(column(solutions, j), variable_names));
+        return true;
+    }
+
+    if (factors.qr && !factors.qr->isRankDeficient()) {
+        std::vector<double> residual_norms;
+        Matrix solutions = factors.qr->solve(constants, residual_norms);
+
+        double coefficient_norm = 0;
+        for (int i = 0; i < m; i++) {
+            for (int k = 0; k < coefficients.cols(); k++)
+                coefficient_norm += coefficients(i, k) * coefficients(i, k);
+        }
+        coefficient_norm = std::sqrt(coefficient_norm);
+
+        for (int j = 0; j < count; j++) {
+            std::vector<double> solution = column(solutions, j);
+            double solution_norm = 0;
+            for (double value: solution)
+                solution_norm += value * value;
+            double constant_norm = 0;
+            for (int i = 0; i < m; i++)
+                constant_norm += constants(i, j) * constants(i, j);
+
+            // a residual within the rounding error of the fit means the equations agree
+            double tolerance = 10 * m * std::numeric_limits<double>::epsilon()
+                               * (coefficient_norm * std::sqrt(solution_norm) + std::sqrt(constant_norm));
+            if (residual_norms[j] <= tolerance)
+                outputs.push_back(formatUnique(solution, variable_names));
+            else
+                outputs.push_back(formatLeastSquares(solution, residual_norms[j], variable_names));
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief find the least squares fit of an inconsistent system with QR
+ * @details the fit minimises the norm of the residual, the differences between
+ * the two sides of the equations, and exists when there are at least as many
+ * equations as variables and no variable depends on the others
+ * @param augmented_matrix the coefficients, with the constants in the last column
+ * @param variable_names the variable of each column
+ * @param output set to the fit and its residual norm if there is one
+ * @return true if the system has a unique least squares fit
+ */
+bool ComputeSysOfLinearEqn::solveLeastSquares(const Matrix &augmented_matrix,
+                                              const std::vector<std::string> &variable_names,
+                                              std::vector<std::string> &output) const {
+    int m = augmented_matrix.getRows();
+    int n = augmented_matrix.getCols() - 1;
+    if (n == 0 || m < n)
+        return false;
+
+    QRDecomposition qr(augmented_matrix.block(0, 0, m, n));
+    if (qr.isRankDeficient())
+        return false;
+    std::vector<double> constants(m);
+    for (int i = 0; i < m; i++)
+        constants[i] = augmented_matrix(i, n);
+    QRDecomposition::Result result = qr.solve(constants);
+
+    output = formatLeastSquares(result.x, result.residualNorm, variable_names);
+    return true;
+}
+
+/**
+ * @brief solve a system exactly with fraction-free elimination
+ * @param augmented_matrix the coefficients, with the constants in the last column
+ * @param variable_names the variable of each column
+ * @param output set to the solution if the coefficients allowed exact elimination
+ * @return true if solved, false if a value does not fit in whole numbers and doubles are needed
+ */
+bool ComputeSysOfLinearEqn::solveExactly(const Matrix &augmented_matrix, const std::vector<std::string> &variable_names,
+                                         std::vector<std::string> &output) const {
+    std::vector<ReducedRow> rows;
+    try {
+        ExactMatrix solution_matrix(augmented_matrix);
+        solution_matrix.reduceToRREF();
+        int constant_col = solution_matrix.getCols() - 1;
+
+        for (int i = 0; i < solution_matrix.getRows(); i++) {
+            ReducedRow row;
+            for (int j = 0; j < constant_col; j++) {
+                Rational value = solution_matrix.at(i, j);
+                if (value.isZero())
+                    continue;
+                if (row.leading == -1)
+                    row.leading = j;
+                else
+                    row.terms.emplace_back(j, (-value).toString());
+            }
+            Rational constant = solution_matrix.at(i, constant_col);
+            if (row.leading == -1 && !constant.isZero()) {
+                // System is inconsistent, give the closest fit if there is one
+                if (!solveLeastSquares(augmented_matrix, variable_names, output))
+                    output.push_back("There are no solutions for the given system");
+                return true;
+            }
+            row.constant = constant.toString();
+            rows.push_back(row);
+        }
+    } catch (std::runtime_error &) {
+        return false;
+    }
+    output = formatSolution(rows, variable_names);
+    return true;
+}
+
+/**
+ * @brief function to take a set of linear equations and get solutions to the system of linear equations
+ * @param equations the equations of the system
+ * @return the solutions to the system of linear equations
+ */
+std::vector<std::string> ComputeSysOfLinearEqn::solve(const std::vector<std::string>& equations) const {
+    try {
+        LinearSystem system = parseEquations(equations);
+        return solveAugmented(system.getAugmentedMatrix(), system.getVariableNames());
     } catch (std::exception &e) {
         throw std::runtime_error(e.what());
     }
 }
 
+/**
+ * @brief solve a system for many sets of constants, the equations are only parsed and factored once
+ * @details the constants of an equation are the value its variables add up to once they are
+ * moved to the left hand side and the numbers to the right, so "x + 1 = y" has x - y = -1
+ * @param equations the equations of the system, their own constants are ignored
+ * @param constants the sets of constants, each with one value per equation
+ * @return the solutions for each set of constants
+ */
+std::vector<std::vector<std::string>> ComputeSysOfLinearEqn::solve(const std::vector<std::string> &equations,
+                                                                   const std::vector<std::vector<double>> &constants) const {
+    try {
+        LinearSystem system = parseEquations(equations);
+        std::vector<std::string> variable_names = system.getVariableNames();
+        SparseMatrix augmented_matrix = system.getAugmentedMatrix();
+        int m = augmented_matrix.getRows();
+        int n = augmented_matrix.getCols() - 1;
+        for (const std::vector<double> &set: constants) {
+            if ((int) set.size() != m)
+                throw std::runtime_error("Each set of constants needs one value per equation");
+        }
+
+        std::vector<std::vector<std::string>> outputs;
+        if (constants.empty())
+            return outputs;
+
+        // every set of constants at once with the factors of the coefficients
+        if (!iterative && arithmetic == Arithmetic::Floating && !isSparse(augmented_matrix)) {
+            Matrix dense = augmented_matrix.toMatrix();
+            Matrix right_hand_sides(m, constants.size());
+            for (int j = 0; j < (int) constants.size(); j++) {
+                for (int i = 0; i < m; i++)
+                    right_hand_sides(i, j) = constants[j][i];
+            }
+            if (solveFactored(dense.block(0, 0, m, n), right_hand_sides.view(), variable_names, outputs))
+                return outputs;
+        }
 
+        for (const std::vector<double> &set: constants)
+            outputs.push_back(solveAugmented(withConstants(augmented_matrix, set), variable_names));
+        return outputs;
+    } catch (std::exception &e) {
+        throw std::runtime_error(e.what());
+    }
+}
+
+/**
+ * @brief solve a parsed system
+ * @param augmented_matrix the coefficients, with the constants in the last column
+ * @param variable_names the variable of each column
+ * @return the solutions to the system of linear equations
+ */
+std::vector<std::string> ComputeSysOfLinearEqn::solveAugmented(const SparseMatrix &augmented_matrix,
+                                                               const std::vector<std::string> &variable_names) const {
+    std::vector<std::string> output;
+
+    if (iterative && solveIteratively(augmented_matrix, variable_names, output))
+        return output;
+    if (arithmetic == Arithmetic::Exact && solveExactly(augmented_matrix.toMatrix(), variable_names, output))
+        return output;
+
+    // Get the RREF of the system of linear equations, large systems that are mostly
+    // zeros are reduced in sparse form so the work follows the non-zeros. Dense systems
+    // with a unique solution or fit are solved with factors that are kept for next time
+    SparseMatrix solution_matrix = augmented_matrix;
+    if (isSparse(solution_matrix)) {
+        solution_matrix.reduceToRREF();
+    } else {
+        Matrix dense = solution_matrix.toMatrix();
+        int n = dense.getCols() - 1;
+        std::vector<std::vector<std::string>> outputs;
+        if (solveFactored(dense.block(0, 0, dense.getRows(), n), dense.block(0, n, dense.getRows(), 1),
+                          variable_names, outputs))
+            return outputs[0];
+        dense.reduceToRREF();
+        solution_matrix = SparseMatrix(dense);
+    }
+
+    const std::vector<int> &row_start = solution_matrix.getRowStart();
+    const std::vector<int> &col_index = solution_matrix.getColIndex();
+    const std::vector<double> &values = solution_matrix.getValues();
+    int constant_col = solution_matrix.getCols() - 1;
+
+    std::vector<ReducedRow> rows;
+    for (int i = 0; i < solution_matrix.getRows(); i++) {
+        // a row whose only non-zero is the constant
+        if (row_start[i + 1] - row_start[i] == 1 && col_index[row_start[i]] == constant_col) {
+            // System is inconsistent, give the closest fit if there is one and the dense
+            // copy it needs is small enough, however sparse the system is
+            bool fits = (long) augmented_matrix.getRows() * augmented_matrix.getCols() <= leastSquaresMaximumSize;
+            if (!fits || !solveLeastSquares(augmented_matrix.toMatrix(), variable_names, output))
+                output.push_back("There are no solutions for the given system");
+            return output;
+        }
+
+        // the first entry of each row is its leading 1, which rounding can leave a hair off 1
+        ReducedRow row;
+        for (int k = row_start[i]; k < row_start[i + 1] && col_index[k] < constant_col; k++) {
+            if (k == row_start[i])
+                row.leading = col_index[k];
+            else
+                row.terms.emplace_back(col_index[k], Utilities::removeTrailingZeros(-values[k]));
+        }
+        row.constant = Utilities::removeTrailingZeros(solution_matrix.at(i, constant_col));
+        if (row.leading >= 0)
+            rows.push_back(row);
+    }
+    return formatSolution(rows, variable_names);
+}
@@ -0,0 +1,506 @@
+/**
+ * @brief This class holds the array kernels used for batch evaluation.
+ *
+ * @details Every operation of a CompiledExpression has a kernel that runs it
+ * over a whole block of values. There is a scalar set, an SSE2 set and an
+ * AVX2/FMA set, and select() picks the widest one the running CPU supports.
+ * Trig kernels take degrees and log kernels are base 10, the same as the
+ * Trig and Log functions.
+ *
+ * The SSE2 set vectorizes the arithmetic only, its trig and log kernels are
+ * the scalar ones. The AVX2 set also vectorizes sin, cos, tan and log with
+ * the Cephes (sin, cos) and fdlibm (log) polynomials, lanes outside of their
+ * accurate range are recomputed with the standard library.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <cmath>
+#include <cfloat>
+
+#include "../../../include/model/analyser/BatchKernels.h"
+#include "../../../include/model/utilities/CpuFeatures.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define BATCH_KERNELS_X86
+#include <immintrin.h>
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+#define SSE2_TARGET __attribute__((target("sse2")))
+#endif
+
+static const double PI = std::atan(1) * 4;
+static const double LN10 = std::log(10);
+
+
+// ---------------------------------------------------------------------------
+// scalar kernels, also used for the tails of the vector kernels
+// ---------------------------------------------------------------------------
+
+static void scalarAdd(const double *left, const double *right, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = left[i] + right[i];
+    }
+}
+
+static void scalarSubtract(const double *left, const double *right, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = left[i] - right[i];
+    }
+}
+
+static void scalarMultiply(const double *left, const double *right, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = left[i] * right[i];
+    }
+}
+
+static bool scalarDivide(const double *left, const double *right, double *out, int count) {
+    bool zero = false;
+    for (int i = 0; i < count; i++) {
+        zero |= right[i] == 0;
+        out[i] = left[i] / right[i];
+    }
+    return zero;
+}
+
+static void scalarPower(const double *left, const double *right, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = std::pow(left[i], right[i]);
+    }
+}
+
+static void scalarPowerInteger(const double *in, int exponent, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = std::pow(in[i], exponent);
+    }
+}
+
+static void scalarSqrt(const double *in, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = std::sqrt(in[i]);
+    }
+}
+
+static void scalarSin(const double *in, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = std::sin(in[i] * PI / 180);
+    }
+}
+
+static void scalarCos(const double *in, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = std::cos(in[i] * PI / 180);
+    }
+}
+
+static void scalarTan(const double *in, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = std::tan(in[i] * PI / 180);
+    }
+}
+
+static void scalarLog(const double *in, double *out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = std::log(in[i]) / LN10;
+    }
+}
+
+/**
+ * raise to an integer power by repeated squaring, the same steps as the
+ * vector kernels so that a tail gives the same result as a full vector
+ */
+static double squaringPower(double base, int exponent) {
+    unsigned int e = exponent < 0 ? -(unsigned int) exponent : exponent;
+    double result = 1;
+    while (e) {
+        if (e & 1) {
+            result *= base;
+        }
+        base *= base;
+        e >>= 1;
+    }
+    return exponent < 0 ? 1 / result : result;
+}
+
+
+#ifdef BATCH_KERNELS_X86
+
+// ---------------------------------------------------------------------------
+// SSE2 kernels
+// ---------------------------------------------------------------------------
+
+SSE2_TARGET static void sse2Add(const double *left, const double *right, double *out, int count) {
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(left + i), _mm_loadu_pd(right + i)));
+    }
+    scalarAdd(left + i, right + i, out + i, count - i);
+}
+
+SSE2_TARGET static void sse2Subtract(const double *left, const double *right, double *out, int count) {
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_sub_pd(_mm_loadu_pd(left + i), _mm_loadu_pd(right + i)));
+    }
+    scalarSubtract(left + i, right + i, out + i, count - i);
+}
+
+SSE2_TARGET static void sse2Multiply(const double *left, const double *right, double *out, int count) {
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(left + i), _mm_loadu_pd(right + i)));
+    }
+    scalarMultiply(left + i, right + i, out + i, count - i);
+}
+
+SSE2_TARGET static bool sse2Divide(const double *left, const double *right, double *out, int count) {
+    __m128d zero = _mm_setzero_pd();
+    __m128d found = _mm_setzero_pd();
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128d denominator = _mm_loadu_pd(right + i);
+        found = _mm_or_pd(found, _mm_cmpeq_pd(denominator, zero));
+        _mm_storeu_pd(out + i, _mm_div_pd(_mm_loadu_pd(left + i), denominator));
+    }
+    bool tail = scalarDivide(left + i, right + i, out + i, count - i);
+    return tail || _mm_movemask_pd(found) != 0;
+}
+
+SSE2_TARGET static void sse2PowerInteger(const double *in, int exponent, double *out, int count) {
+    unsigned int magnitude = exponent < 0 ? -(unsigned int) exponent : exponent;
+    __m128d one = _mm_set1_pd(1);
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128d base = _mm_loadu_pd(in + i);
+        __m128d result = one;
+        for (unsigned int e = magnitude; e; e >>= 1) {
+            if (e & 1) {
+                result = _mm_mul_pd(result, base);
+            }
+            base = _mm_mul_pd(base, base);
+        }
+        if (exponent < 0) {
+            result = _mm_div_pd(one, result);
+        }
+        _mm_storeu_pd(out + i, result);
+    }
+    for (; i < count; i++) {
+        out[i] = squaringPower(in[i], exponent);
+    }
+}
+
+SSE2_TARGET static void sse2Sqrt(const double *in, double *out, int count) {
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(out + i, _mm_sqrt_pd(_mm_loadu_pd(in + i)));
+    }
+    scalarSqrt(in + i, out + i, count - i);
+}
+
+
+// ---------------------------------------------------------------------------
+// AVX2 kernels
+// ---------------------------------------------------------------------------
+
+// Cephes sin/cos reduction constants, pi/4 split into three parts
+static const double DP1 = 7.85398125648498535156E-1;
+static const double DP2 = 3.77489470793079817668E-8;
+static const double DP3 = 2.69515142907905952645E-15;
+// above this the reduction loses precision, those lanes use std::sin
+static const double TRIG_LIMIT = 1.073741824e9;
+
+static const double SIN_COEF[] = {1.58962301576546568060E-10, -2.50507477628578072866E-8,
+                                  2.75573136213857245213E-6, -1.98412698295895385996E-4,
+                                  8.33333333332211858878E-3, -1.66666666666666307295E-1};
+static const double COS_COEF[] = {-1.13585365213876817300E-11, 2.08757008419747316778E-9,
+                                  -2.75573141792967388112E-7, 2.48015872888517045348E-5,
+                                  -1.38888888888730564116E-3, 4.16666666666665929218E-2};
+
+// fdlibm log constants
+static const double LN2_HI = 6.93147180369123816490E-01;
+static const double LN2_LO = 1.90821492927058770002E-10;
+static const double LG1 = 6.666666666666735130E-01;
+static const double LG2 = 3.999999999940941908E-01;
+static const double LG3 = 2.857142874366239149E-01;
+static const double LG4 = 2.222219843214978396E-01;
+static const double LG5 = 1.818357216161805012E-01;
+static const double LG6 = 1.531383769920937332E-01;
+static const double LG7 = 1.479819860511658591E-01;
+
+AVX2_TARGET static inline __m256d avx2Polynomial(__m256d x, const double *coef, int size) {
+    __m256d result = _mm256_set1_pd(coef[0]);
+    for (int i = 1; i < size; i++) {
+        result = _mm256_fmadd_pd(result, x, _mm256_set1_pd(coef[i]));
+    }
+    return result;
+}
+
+/**
+ * sin and cos of four angles in radians, the lanes must be finite and
+ * smaller than TRIG_LIMIT in magnitude
+ */
+AVX2_TARGET static inline void avx2SinCos(__m256d x, __m256d *sinOut, __m256d *cosOut) {
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    const __m256d one = _mm256_set1_pd(1);
+    const __m256d two = _mm256_set1_pd(2);
+    const __m256d four = _mm256_set1_pd(4);
+    const __m256d eight = _mm256_set1_pd(8);
+
+    __m256d absolute = _mm256_andnot_pd(signMask, x);
+    __m256d inputSign = _mm256_and_pd(signMask, x);
+
+    // octant of the angle, odd octants move to the next even one
+    __m256d y = _mm256_floor_pd(_mm256_mul_pd(absolute, _mm256_set1_pd(4 / PI)));
+    __m256d j = _mm256_sub_pd(y, _mm256_mul_pd(_mm256_floor_pd(_mm256_mul_pd(y, _mm256_set1_pd(0.125))), eight));
+    __m256d odd = _mm256_sub_pd(j, _mm256_mul_pd(_mm256_floor_pd(_mm256_mul_pd(j, _mm256_set1_pd(0.5))), two));
+    y = _mm256_add_pd(y, odd);
+    j = _mm256_add_pd(j, odd);
+    j = _mm256_sub_pd(j, _mm256_and_pd(_mm256_cmp_pd(j, eight, _CMP_GE_OQ), eight));
+
+    // octants 4 and 6 flip the sign, octants 2 and 6 swap the polynomials
+    __m256d upper = _mm256_cmp_pd(j, four, _CMP_GE_OQ);
+    j = _mm256_sub_pd(j, _mm256_and_pd(upper, four));
+    __m256d swap = _mm256_cmp_pd(j, two, _CMP_EQ_OQ);
+
+    // extended precision reduction to [-pi/4, pi/4]
+    __m256d z = _mm256_fnmadd_pd(y, _mm256_set1_pd(DP1), absolute);
+    z = _mm256_fnmadd_pd(y, _mm256_set1_pd(DP2), z);
+    z = _mm256_fnmadd_pd(y, _mm256_set1_pd(DP3), z);
+    __m256d zz = _mm256_mul_pd(z, z);
+
+    __m256d sinPoly = _mm256_fmadd_pd(_mm256_mul_pd(z, zz), avx2Polynomial(zz, SIN_COEF, 6), z);
+    __m256d cosPoly = _mm256_fmadd_pd(_mm256_mul_pd(zz, zz), avx2Polynomial(zz, COS_COEF, 6),
+                                      _mm256_fnmadd_pd(_mm256_set1_pd(0.5), zz, one));
+
+    __m256d sinValue = _mm256_blendv_pd(sinPoly, cosPoly, swap);
+    __m256d cosValue = _mm256_blendv_pd(cosPoly, sinPoly, swap);
+
+    *sinOut = _mm256_xor_pd(sinValue, _mm256_xor_pd(inputSign, _mm256_and_pd(upper, signMask)));
+    *cosOut = _mm256_xor_pd(cosValue, _mm256_and_pd(_mm256_xor_pd(upper, swap), signMask));
+}
+
+/**
+ * natural logarithm of four positive, normal and finite values
+ */
+AVX2_TARGET static inline __m256d avx2Ln(__m256d x) {
+    const __m256d one = _mm256_set1_pd(1);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d magic = _mm256_set1_pd(4503599627370496.0);
+    __m256i bits = _mm256_castpd_si256(x);
+
+    // unbiased exponent as a double, the exponent field is ored into 2^52
+    __m256i exponentBits = _mm256_srli_epi64(bits, 52);
+    __m256d k = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(exponentBits, _mm256_castpd_si256(magic))),
+                              magic);
+    k = _mm256_sub_pd(k, _mm256_set1_pd(1023));
+
+    // mantissa in [1, 2), then moved into [sqrt(2)/2, sqrt(2))
+    __m256i mantissaBits = _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(mantissaBits, _mm256_set1_epi64x(0x3FF0000000000000LL)));
+    __m256d large = _mm256_cmp_pd(m, _mm256_set1_pd(M_SQRT2), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, half), large);
+    k = _mm256_add_pd(k, _mm256_and_pd(large, one));
+
+    __m256d f = _mm256_sub_pd(m, one);
+    __m256d s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2), f));
+    __m256d z = _mm256_mul_pd(s, s);
+    __m256d w = _mm256_mul_pd(z, z);
+
+    __m256d t1 = _mm256_fmadd_pd(w, _mm256_set1_pd(LG6), _mm256_set1_pd(LG4));
+    t1 = _mm256_mul_pd(w, _mm256_fmadd_pd(w, t1, _mm256_set1_pd(LG2)));
+    __m256d t2 = _mm256_fmadd_pd(w, _mm256_set1_pd(LG7), _mm256_set1_pd(LG5));
+    t2 = _mm256_fmadd_pd(w, t2, _mm256_set1_pd(LG3));
+    t2 = _mm256_mul_pd(z, _mm256_fmadd_pd(w, t2, _mm256_set1_pd(LG1)));
+    __m256d r = _mm256_add_pd(t1, t2);
+
+    __m256d halfSquare = _mm256_mul_pd(_mm256_mul_pd(half, f), f);
+    __m256d correction = _mm256_fmadd_pd(s, _mm256_add_pd(halfSquare, r), _mm256_mul_pd(k, _mm256_set1_pd(LN2_LO)));
+    return _mm256_sub_pd(_mm256_mul_pd(k, _mm256_set1_pd(LN2_HI)),
+                         _mm256_sub_pd(_mm256_sub_pd(halfSquare, correction), f));
+}
+
+AVX2_TARGET static void avx2Add(const double *left, const double *right, double *out, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(left + i), _mm256_loadu_pd(right + i)));
+    }
+    scalarAdd(left + i, right + i, out + i, count - i);
+}
+
+AVX2_TARGET static void avx2Subtract(const double *left, const double *right, double *out, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_loadu_pd(left + i), _mm256_loadu_pd(right + i)));
+    }
+    scalarSubtract(left + i, right + i, out + i, count - i);
+}
+
+AVX2_TARGET static void avx2Multiply(const double *left, const double *right, double *out, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(left + i), _mm256_loadu_pd(right + i)));
+    }
+    scalarMultiply(left + i, right + i, out + i, count - i);
+}
+
+AVX2_TARGET static bool avx2Divide(const double *left, const double *right, double *out, int count) {
+    __m256d zero = _mm256_setzero_pd();
+    __m256d found = _mm256_setzero_pd();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d denominator = _mm256_loadu_pd(right + i);
+        found = _mm256_or_pd(found, _mm256_cmp_pd(denominator, zero, _CMP_EQ_OQ));
+        _mm256_storeu_pd(out + i, _mm256_div_pd(_mm256_loadu_pd(left + i), denominator));
+    }
+    bool tail = scalarDivide(left + i, right + i, out + i, count - i);
+    return tail || _mm256_movemask_pd(found) != 0;
+}
+
+AVX2_TARGET static void avx2PowerInteger(const double *in, int exponent, double *out, int count) {
+    unsigned int magnitude = exponent < 0 ? -(unsigned int) exponent : exponent;
+    __m256d one = _mm256_set1_pd(1);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d base = _mm256_loadu_pd(in + i);
+        __m256d result = one;
+        for (unsigned int e = magnitude; e; e >>= 1) {
+            if (e & 1) {
+                result = _mm256_mul_pd(result, base);
+            }
+            base = _mm256_mul_pd(base, base);
+        }
+        if (exponent < 0) {
+            result = _mm256_div_pd(one, result);
+        }
+        _mm256_storeu_pd(out + i, result);
+    }
+    for (; i < count; i++) {
+        out[i] = squaringPower(in[i], exponent);
+    }
+}
+
+AVX2_TARGET static void avx2Sqrt(const double *in, double *out, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, _mm256_sqrt_pd(_mm256_loadu_pd(in + i)));
+    }
+    scalarSqrt(in + i, out + i, count - i);
+}
+
+/**
+ * shared body of the trig kernels, which selects sin, cos or tan
+ */
+AVX2_TARGET static inline void avx2Trig(const double *in, double *out, int count, int which,
+                                        void (*fallback)(const double *, double *, int)) {
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    const __m256d limit = _mm256_set1_pd(TRIG_LIMIT);
+    const __m256d pi = _mm256_set1_pd(PI);
+    const __m256d degrees = _mm256_set1_pd(180);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        // same rounding as the scalar x * PI / 180
+        __m256d x = _mm256_div_pd(_mm256_mul_pd(_mm256_loadu_pd(in + i), pi), degrees);
+        __m256d inRange = _mm256_cmp_pd(_mm256_andnot_pd(signMask, x), limit, _CMP_LE_OQ);
+        if (_mm256_movemask_pd(inRange) != 0xF) {
+            fallback(in + i, out + i, 4);
+            continue;
+        }
+
+        __m256d sinValue, cosValue;
+        avx2SinCos(x, &sinValue, &cosValue);
+        if (which == 0) {
+            _mm256_storeu_pd(out + i, sinValue);
+        } else if (which == 1) {
+            _mm256_storeu_pd(out + i, cosValue);
+        } else {
+            _mm256_storeu_pd(out + i, _mm256_div_pd(sinValue, cosValue));
+        }
+    }
+    fallback(in + i, out + i, count - i);
+}
+
+AVX2_TARGET static void avx2Sin(const double *in, double *out, int count) {
+    avx2Trig(in, out, count, 0, scalarSin);
+}
+
+AVX2_TARGET static void avx2Cos(const double *in, double *out, int count) {
+    avx2Trig(in, out, count, 1, scalarCos);
+}
+
+AVX2_TARGET static void avx2Tan(const double *in, double *out, int count) {
+    avx2Trig(in, out, count, 2, scalarTan);
+}
+
+AVX2_TARGET static void avx2Log(const double *in, double *out, int count) {
+    const __m256d smallest = _mm256_set1_pd(DBL_MIN);
+    const __m256d largest = _mm256_set1_pd(DBL_MAX);
+    const __m256d ln10 = _mm256_set1_pd(LN10);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d x = _mm256_loadu_pd(in + i);
+        // zero, negative, subnormal, infinite and NaN lanes use std::log
+        __m256d normal = _mm256_and_pd(_mm256_cmp_pd(x, smallest, _CMP_GE_OQ),
+                                       _mm256_cmp_pd(x, largest, _CMP_LE_OQ));
+        if (_mm256_movemask_pd(normal) != 0xF) {
+            scalarLog(in + i, out + i, 4);
+            continue;
+        }
+        _mm256_storeu_pd(out + i, _mm256_div_pd(avx2Ln(x), ln10));
+    }
+    scalarLog(in + i, out + i, count - i);
+}
+
+#endif
+
+
+// ---------------------------------------------------------------------------
+// kernel tables
+// ---------------------------------------------------------------------------
+
+static const BatchKernels SCALAR_KERNELS = {
+        BatchKernels::Level::Scalar, "scalar",
+        scalarAdd, scalarSubtract, scalarMultiply, scalarDivide, scalarPower, scalarPowerInteger,
+        scalarSqrt, scalarSin, scalarCos, scalarTan, scalarLog
+};
+
+#ifdef BATCH_KERNELS_X86
+static const BatchKernels SSE2_KERNELS = {
+        BatchKernels::Level::SSE2, "sse2",
+        sse2Add, sse2Subtract, sse2Multiply, sse2Divide, scalarPower, sse2PowerInteger,
+        sse2Sqrt, scalarSin, scalarCos, scalarTan, scalarLog
+};
+
+static const BatchKernels AVX2_KERNELS = {
+        BatchKernels::Level::AVX2, "avx2",
+        avx2Add, avx2Subtract, avx2Multiply, avx2Divide, scalarPower, avx2PowerInteger,
+        avx2Sqrt, avx2Sin, avx2Cos, avx2Tan, avx2Log
+};
+#endif
+
+
+/**
+ * get the widest kernels that the running CPU supports
+ * @return the kernel table
+ */
+const BatchKernels &BatchKernels::select() {
+    return forLevel(Level::AVX2);
+}
+
+
+/**
+ * get the kernels of a level, or the widest supported level below it
+ * @param level the requested level
+ * @return the kernel table
+ */
+const BatchKernels &BatchKernels::forLevel(Level level) {
+#ifdef BATCH_KERNELS_X86
+    if (level == Level::AVX2 && CpuFeatures::hasAvx2()) {
+        return AVX2_KERNELS;
+    }
+    if (level != Level::Scalar && CpuFeatures::hasSse2()) {
+        return SSE2_KERNELS;
+    }
+#endif
+    return SCALAR_KERNELS;
+}
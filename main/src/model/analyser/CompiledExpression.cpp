@@ -0,0 +1,474 @@
+/**
+ * @brief This class compiles a function string into a flat evaluation program.
+ *
+ * @details The CompiledExpression class runs the Lexer and Parser once and
+ * flattens the resulting Abstract Syntax Tree (AST) into an immutable postfix
+ * program. Every distinct variable gets a named slot, so the program can be
+ * evaluated for any binding of the variables without lexing, parsing or
+ * allocating again. Constant subtrees are folded while compiling.
+ * evaluateBatch() runs the program over whole arrays of inputs with the
+ * vectorized BatchKernels.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <algorithm>
+
+#include "../../../include/model/analyser/CompiledExpression.h"
+#include "../../../include/model/analyser/Lexer.h"
+#include "../../../include/model/analyser/Parser.h"
+#include "../../../include/model/analyser/ParseSession.h"
+
+// programs that need a deeper stack than this fall back to a heap buffer
+static const int INLINE_STACK_DEPTH = 64;
+
+// number of inputs evaluated per block in evaluateBatch, small enough that
+// the scratch buffers of a block stay in the L1 cache
+static const int BATCH_BLOCK = 256;
+
+// largest constant integer exponent that is computed by repeated squaring
+static const int MAX_SQUARING_EXPONENT = 64;
+
+static const double PI = std::atan(1) * 4;
+
+/**
+ * parameterised constructor, compiles the function once
+ * @param function the function string, e.g. "2x^2+sin(x)"
+ */
+CompiledExpression::CompiledExpression(const std::string &function) {
+    stackDepth = 0;
+
+    // the tree is only needed while compiling
+    ParseSession session;
+
+    Lexer lexer(function);
+    Parser parser = Parser();
+    parser.createParseTree(lexer.tokenizer());
+
+    compile(parser.getRoot());
+
+    if (program.empty()) {
+        throw std::runtime_error("Invalid Expression");
+    }
+
+    // recompute the stack depth of the final (folded) program
+    int depth = 0;
+    for (const Instruction &instruction: program) {
+        if (instruction.op == OpCode::Constant || instruction.op == OpCode::Variable) {
+            depth++;
+            stackDepth = std::max(stackDepth, depth);
+        } else if (instruction.op < OpCode::Sin) {
+            depth--;
+        }
+    }
+}
+
+
+/**
+ * evaluate the program with every variable bound to x.
+ * This matches ComputeFunction, which substitutes x for every variable.
+ * @param x the value of the variables
+ * @return the value of the function
+ */
+double CompiledExpression::evaluate(double x) const {
+    // a zero stride makes every slot read the same value
+    if (stackDepth <= INLINE_STACK_DEPTH) {
+        double stack[INLINE_STACK_DEPTH];
+        return run(&x, stack, 0);
+    }
+    std::vector<double> stack(stackDepth);
+    return run(&x, stack.data(), 0);
+}
+
+
+/**
+ * evaluate the program with a value for each variable slot
+ * @param bindings the values indexed by slot, see getSlot()
+ * @return the value of the function
+ */
+double CompiledExpression::evaluate(const double *bindings) const {
+    if (stackDepth <= INLINE_STACK_DEPTH) {
+        double stack[INLINE_STACK_DEPTH];
+        return run(bindings, stack, 1);
+    }
+    std::vector<double> stack(stackDepth);
+    return run(bindings, stack.data(), 1);
+}
+
+
+/**
+ * evaluate the program for every input with every variable bound to that
+ * input, using the widest kernels that the CPU supports
+ * @param xs the inputs
+ * @param ys the outputs, may be the same array as xs
+ * @param count the number of inputs
+ */
+void CompiledExpression::evaluateBatch(const double *xs, double *ys, std::size_t count) const {
+    evaluateBatch(xs, ys, count, BatchKernels::select());
+}
+
+
+/**
+ * evaluate the program for every input with every variable bound to that
+ * input, using the given kernels
+ * @param xs the inputs
+ * @param ys the outputs, may be the same array as xs
+ * @param count the number of inputs
+ * @param kernels the kernels to run the operations with
+ */
+void CompiledExpression::evaluateBatch(const double *xs, double *ys, std::size_t count,
+                                       const BatchKernels &kernels) const {
+    // one block of scratch per stack level
+    std::vector<double> scratch((std::size_t) std::max(stackDepth, 1) * BATCH_BLOCK);
+
+    for (std::size_t offset = 0; offset < count; offset += BATCH_BLOCK) {
+        int size = (int) std::min<std::size_t>(BATCH_BLOCK, count - offset);
+        runBlock(xs + offset, ys + offset, size, kernels, scratch.data());
+    }
+}
+
+
+/**
+ * get the slot index of a variable
+ * @param variable the id of the variable name in the SymbolTable
+ * @return the slot of the variable, -1 if the function does not use it
+ */
+int CompiledExpression::getSlot(int variable) const {
+    for (int i = 0; i < (int) variables.size(); i++) {
+        if (variables.at(i) == variable) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+/**
+ * getter method for the variables, indexed by slot
+ * @return the ids of the variable names in the SymbolTable
+ */
+const std::vector<int> &CompiledExpression::getVariables() const {
+    return variables;
+}
+
+
+/**
+ * getter method for the postfix program
+ * @return the instructions in evaluation order
+ */
+const std::vector<CompiledExpression::Instruction> &CompiledExpression::getProgram() const {
+    return program;
+}
+
+
+/**
+ * getter method for the evaluation stack depth
+ * @return the maximum number of values on the stack
+ */
+int CompiledExpression::getStackDepth() const {
+    return stackDepth;
+}
+
+
+/**
+ * flatten the tree in postfix order
+ * @param node the root of the tree to compile
+ */
+void CompiledExpression::compile(Node *node) {
+    if (!node || !node->getValue()) {
+        throw std::runtime_error("Invalid Expression");
+    }
+
+    Token *token = node->getValue();
+
+    // a number or variable with children was left waiting for an operation, as in
+    // "2sin(x)", skipping the children would silently drop part of the function
+    if ((token->getType() == Token::Type::Number || token->getType() == Token::Type::Variable)
+            && (node->getLeft() || node->getRight())) {
+        throw std::runtime_error("Invalid Expression");
+    }
+
+    switch (token->getType()) {
+        case Token::Type::Number:
+            emitConstant(std::stod(token->value, nullptr));
+            break;
+        case Token::Type::Variable: {
+            int variable = token->symbol;
+            int slot = getSlot(variable);
+            if (slot == -1) {
+                slot = (int) variables.size();
+                variables.push_back(variable);
+            }
+            program.push_back({OpCode::Variable, 0, slot});
+            break;
+        }
+        case Token::Type::Plus:
+        case Token::Type::Minus:
+        case Token::Type::Mul:
+        case Token::Type::Div:
+        case Token::Type::Power:
+            if (!node->getLeft() || !node->getRight()) {
+                throw std::runtime_error("Invalid Expression");
+            }
+            compile(node->getLeft());
+            compile(node->getRight());
+
+            if (token->getType() == Token::Type::Plus) {
+                emit(OpCode::Add);
+            } else if (token->getType() == Token::Type::Minus) {
+                emit(OpCode::Subtract);
+            } else if (token->getType() == Token::Type::Mul) {
+                emit(OpCode::Multiply);
+            } else if (token->getType() == Token::Type::Div) {
+                emit(OpCode::Divide);
+            } else {
+                emit(OpCode::Power);
+            }
+            break;
+        default:
+            throw std::runtime_error("Cannot evaluate " + token->value + " in a function");
+    }
+
+    // the special operation applies to the whole subtree
+    if (Token *specialOp = node->getSpecialOp()) {
+        if (specialOp->getType() == Token::Type::Trig) {
+            if (specialOp->value == "sin") {
+                emit(OpCode::Sin);
+            } else if (specialOp->value == "cos") {
+                emit(OpCode::Cos);
+            } else {
+                emit(OpCode::Tan);
+            }
+        } else if (specialOp->getType() == Token::Type::Log) {
+            emit(OpCode::Log);
+        } else {
+            throw std::runtime_error("Cannot evaluate " + specialOp->value + " in a function");
+        }
+    }
+}
+
+
+/**
+ * append an operation, folding it if all of its operands are constants
+ * @param op the operation to append
+ */
+void CompiledExpression::emit(OpCode op) {
+    bool unary = op >= OpCode::Sin;
+    int operands = unary ? 1 : 2;
+
+    bool constant = (int) program.size() >= operands;
+    for (int i = 1; constant && i <= operands; i++) {
+        constant = program.at(program.size() - i).op == OpCode::Constant;
+    }
+
+    if (!constant) {
+        program.push_back({op, 0, -1});
+        return;
+    }
+
+    double right = program.back().value;
+    program.pop_back();
+    if (unary) {
+        emitConstant(apply(op, right, 0));
+    } else {
+        double left = program.back().value;
+        program.pop_back();
+        emitConstant(apply(op, left, right));
+    }
+}
+
+
+/**
+ * append a constant value
+ * @param value the constant
+ */
+void CompiledExpression::emitConstant(double value) {
+    program.push_back({OpCode::Constant, value, -1});
+}
+
+
+/**
+ * run the program on a caller provided stack
+ * @param bindings the variable values
+ * @param stack a buffer of at least getStackDepth() values
+ * @param stride the distance between slots in bindings
+ * @return the value on top of the stack
+ */
+double CompiledExpression::run(const double *bindings, double *stack, int stride) const {
+    int top = -1;
+    for (const Instruction &instruction: program) {
+        switch (instruction.op) {
+            case OpCode::Constant:
+                stack[++top] = instruction.value;
+                break;
+            case OpCode::Variable:
+                stack[++top] = bindings[instruction.slot * stride];
+                break;
+            case OpCode::Sin:
+            case OpCode::Cos:
+            case OpCode::Tan:
+            case OpCode::Log:
+                stack[top] = apply(instruction.op, stack[top], 0);
+                break;
+            default:
+                stack[top - 1] = apply(instruction.op, stack[top - 1], stack[top]);
+                top--;
+        }
+    }
+    return stack[0];
+}
+
+
+/**
+ * run the program over one block of inputs. Every stack level owns a block of
+ * scratch, operands are either a block of values or a constant that is only
+ * written out when a kernel needs it.
+ * @param xs the inputs of the block
+ * @param ys the outputs of the block
+ * @param count the number of inputs, at most BATCH_BLOCK
+ * @param kernels the kernels to run the operations with
+ * @param scratch a buffer of getStackDepth() blocks
+ */
+void CompiledExpression::runBlock(const double *xs, double *ys, int count, const BatchKernels &kernels,
+                                  double *scratch) const {
+    struct Operand {
+        const double *data;
+        double value;
+        bool constant;
+    };
+
+    // writes a constant operand into the scratch of its level
+    auto materialize = [&](Operand &operand, int level) {
+        if (operand.constant) {
+            double *buffer = scratch + (std::size_t) level * BATCH_BLOCK;
+            std::fill(buffer, buffer + count, operand.value);
+            operand.data = buffer;
+        }
+    };
+
+    Operand inlineStack[INLINE_STACK_DEPTH];
+    std::vector<Operand> heapStack;
+    Operand *stack = inlineStack;
+    if (stackDepth > INLINE_STACK_DEPTH) {
+        heapStack.resize(stackDepth);
+        stack = heapStack.data();
+    }
+
+    int top = -1;
+    for (const Instruction &instruction: program) {
+        if (instruction.op == OpCode::Constant) {
+            stack[++top] = {nullptr, instruction.value, true};
+            continue;
+        }
+        if (instruction.op == OpCode::Variable) {
+            // every variable is bound to the input
+            stack[++top] = {xs, 0, false};
+            continue;
+        }
+
+        double *out;
+        if (instruction.op >= OpCode::Sin) {
+            Operand &operand = stack[top];
+            materialize(operand, top);
+            out = scratch + (std::size_t) top * BATCH_BLOCK;
+
+            if (instruction.op == OpCode::Sin) {
+                kernels.sin(operand.data, out, count);
+            } else if (instruction.op == OpCode::Cos) {
+                kernels.cos(operand.data, out, count);
+            } else if (instruction.op == OpCode::Tan) {
+                kernels.tan(operand.data, out, count);
+            } else {
+                kernels.log(operand.data, out, count);
+            }
+            operand = {out, 0, false};
+            continue;
+        }
+
+        Operand &left = stack[top - 1];
+        Operand &right = stack[top];
+        out = scratch + (std::size_t) (top - 1) * BATCH_BLOCK;
+
+        if (instruction.op == OpCode::Power && right.constant) {
+            double exponent = right.value;
+            materialize(left, top - 1);
+            if (exponent == 0.5) {
+                kernels.sqrt(left.data, out, count);
+            } else if (exponent == std::floor(exponent) && std::fabs(exponent) <= MAX_SQUARING_EXPONENT) {
+                kernels.powerInteger(left.data, (int) exponent, out, count);
+            } else {
+                materialize(right, top);
+                kernels.power(left.data, right.data, out, count);
+            }
+        } else {
+            materialize(left, top - 1);
+            materialize(right, top);
+            switch (instruction.op) {
+                case OpCode::Add:
+                    kernels.add(left.data, right.data, out, count);
+                    break;
+                case OpCode::Subtract:
+                    kernels.subtract(left.data, right.data, out, count);
+                    break;
+                case OpCode::Multiply:
+                    kernels.multiply(left.data, right.data, out, count);
+                    break;
+                case OpCode::Divide:
+                    if (kernels.divide(left.data, right.data, out, count)) {
+                        throw std::runtime_error("Denominator cannot be 0");
+                    }
+                    break;
+                default:
+                    kernels.power(left.data, right.data, out, count);
+            }
+        }
+        left = {out, 0, false};
+        top--;
+    }
+
+    if (stack[0].constant) {
+        std::fill(ys, ys + count, stack[0].value);
+    } else if (stack[0].data != ys) {
+        std::copy(stack[0].data, stack[0].data + count, ys);
+    }
+}
+
+
+/**
+ * compute a single operation, trig inputs are in degrees like Trig
+ * and logarithms are base 10 like Log
+ * @param op the operation
+ * @param left the left operand, or the only operand of unary operations
+ * @param right the right operand
+ * @return the result of the operation
+ */
+double CompiledExpression::apply(OpCode op, double left, double right) {
+    switch (op) {
+        case OpCode::Add:
+            return left + right;
+        case OpCode::Subtract:
+            return left - right;
+        case OpCode::Multiply:
+            return left * right;
+        case OpCode::Divide:
+            if (right == 0) {
+                throw std::runtime_error("Denominator cannot be 0");
+            }
+            return left / right;
+        case OpCode::Power:
+            return std::pow(left, right);
+        case OpCode::Sin:
+            return std::sin(left * PI / 180);
+        case OpCode::Cos:
+            return std::cos(left * PI / 180);
+        case OpCode::Tan:
+            return std::tan(left * PI / 180);
+        case OpCode::Log:
+            return std::log(left) / std::log(10);
+        default:
+            return left;
+    }
+}
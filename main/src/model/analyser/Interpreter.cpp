@@ -4,7 +4,8 @@
  * @details The Interpreter class takes an AST and reduces the
  * nodes by computing one operation at a time until one node remains.
  * The computation is carried out on the deepest internal node so that
- * the operation with highest precedence is done first.
+ * the operation with highest precedence is done first. The order of the
+ * reductions is scheduled once, in linear time, before reducing.
  *
  * @author Mihir Kadiya
  * @author Brandon Howe
@@ -32,7 +33,6 @@ using namespace std;
  * @param ast the root node of the Abstract Syntax Tree (AST)
  */
 Interpreter::Interpreter(Node *ast) {
-    Interpreter::maxDepth = 0;
     Interpreter::deepestInternalNode = nullptr;
     Interpreter::root = ast;
     groupFactorials(Interpreter::root);
@@ -42,40 +42,54 @@ Interpreter::Interpreter(Node *ast) {
 
 
 /**
- * parameterised constructor
- * @param trees the vector of AST trees
+ * parameterised constructor for a system of linear equations
+ * @param trees the vector of AST trees, one per equation
  */
 Interpreter::Interpreter(std::vector<Node *> trees) {
-    Interpreter::maxDepth = 0;
     Interpreter::deepestInternalNode = nullptr;
+    Interpreter::root = nullptr;
     Interpreter::trees = trees;
     for (Node *tree: trees) {
-        groupFactorials(tree);
-        groupPolyFunctions(tree);
-        groupFunctions(tree);
-        searchLinearEquation(tree);
+        linearSystem.addEquation(tree);
+    }
+}
+
+
+/**
+ * schedule every unreduced node of the tree for reduction.
+ * Reducing the deepest node only removes that node from the candidates,
+ * so the nodes are reduced by decreasing depth and, for equal depths,
+ * in reverse infix order. This is the same node that a search for the
+ * deepest node (last one in infix order wins) finds before every reduction.
+ */
+void Interpreter::buildSchedule() {
+    std::vector<std::vector<Node *>> levels;
+    scheduleNodes(root, 0, levels);
+
+    // the deepest level goes at the back, in infix order so it is popped last first
+    schedule.clear();
+    for (std::vector<Node *> &level: levels) {
+        schedule.insert(schedule.end(), level.begin(), level.end());
     }
 }
 
 
 /**
- * locates the deepest node using infix order
+ * collect the unreduced nodes by depth using infix order
  * @param node the root node to recursively search
  * @param depth the current depth of the node
+ * @param levels the nodes found at each depth
  */
-void Interpreter::setDeepestNode(Node *node, int depth) {
+void Interpreter::scheduleNodes(Node *node, int depth, std::vector<std::vector<Node *>> &levels) {
     if (node != nullptr && !node->reduced) {
-        // search the left subtree for deepest node
-        setDeepestNode(node->getLeft(), depth + 1);
+        scheduleNodes(node->getLeft(), depth + 1, levels);
 
-        // check if the current depth is the greatest so far
-        if (maxDepth <= depth) {
-            maxDepth = depth;
-            deepestInternalNode = node;
+        if ((int) levels.size() <= depth) {
+            levels.resize(depth + 1);
         }
+        levels[depth].push_back(node);
 
-        // search the right subtree for deepest node
-        setDeepestNode(node->getRight(), depth + 1);
+        scheduleNodes(node->getRight(), depth + 1, levels);
     }
 }
 
@@ -185,13 +199,13 @@ void Interpreter::groupPolyFunctions(Node *node) {
 
         if (flag) {
             double coefficient = stod(node->getLeft()->getValue()->value, nullptr);
-            char variable = node->getRight()->getLeft()->getValue()->value[0];
+            int variable = node->getRight()->getLeft()->getValue()->symbol;
             int power = stoi(node->getRight()->getRight()->getValue()->value, nullptr);
 
             auto *p = new Polynomial(coefficient, variable, power);
             Function *f = p;
             node->setFunction(f);
-            node->setValue(new Token(Token::Type::Polynomial, p->toString(), -1));
+            node->setValue(new Token(Token::Type::Polynomial, f, -1));
             node->setLeft(nullptr);
             node->setRight(nullptr);
             node->reduced = true;
@@ -199,10 +213,10 @@ void Interpreter::groupPolyFunctions(Node *node) {
     }
 
     if (node->getValue()->getType() == Token::Type::Variable) {
-        auto *p = new Polynomial(1, node->getValue()->value[0], 1);
+        auto *p = new Polynomial(1, node->getValue()->symbol, 1);
         Function *f = p;
         node->setFunction(f);
-        node->setValue(new Token(Token::Type::Polynomial, p->toString(), -1));
+        node->setValue(new Token(Token::Type::Polynomial, f, -1));
         node->setLeft(nullptr);
         node->setRight(nullptr);
         node->reduced = true;
@@ -217,12 +231,13 @@ void Interpreter::groupPolyFunctions(Node *node) {
  * reduce the AST by solving the operation on the deepest internal node.
  */
 void Interpreter::reduce() {
-    // reset the values
-    maxDepth = 0;
-    deepestInternalNode = nullptr;
+    if (schedule.empty()) {
+        buildSchedule();
+    }
 
-    // set the deepest node
-    setDeepestNode(root, 0);
+    // get the deepest node
+    deepestInternalNode = schedule.back();
+    schedule.pop_back();
 
     // get two children nodes of internal node and its value
     Node *left = deepestInternalNode->getLeft();
@@ -234,18 +249,13 @@ void Interpreter::reduce() {
     Function *f2 = right->getFunction();
     Function *f3 = nullptr;
 
-    // stores the string of double value after computation
-    string value;
-
     // try-catch for any arithmetic errors or undefined behaviour
     try {
-        if (!f1 || !f2) {
-            value = deepestInternalNode->getValue()->value;
-        } else {
+        if (f1 && f2) {
             // if the internal node is =
             if (Token::Type::Equal == token->getType()) {
                 // if right child is a constant, do not reduce
-                if (deepestInternalNode->getRight()->getFunction()->getType() == "Constant") {
+                if (deepestInternalNode->getRight()->getFunction()->getKind() == Function::Kind::Constant) {
                     deepestInternalNode->reduced = true;
                     return;
                 }
@@ -263,64 +273,29 @@ void Interpreter::reduce() {
                 zeroConstant->reduced = true;
                 deepestInternalNode->setRight(zeroConstant);
 
+                // the = node is still unreduced and has a new subtree
+                buildSchedule();
                 return;
             }
 
-
-            // if the internal node is +, add two leaf nodes
+            // if the function is null, the node is already reduced
             if (Token::Type::Plus == token->getType()) {
+                // if the internal node is +, add two leaf nodes
                 f3 = *f1 + *f2;
-                // if function is null, it is already reduced
-                if (f3) {
-                    value = f3->toString();
-                } else {
-                    value = deepestInternalNode->getValue()->value;
-                }
-            }
-
-            // if the internal node is -, subtract two leaf nodes
-            if (Token::Type::Minus == token->getType()) {
+            } else if (Token::Type::Minus == token->getType()) {
+                // if the internal node is -, subtract two leaf nodes
                 f3 = *f1 - *f2;
-                // if function is null, it is already reduced
-                if (f3) {
-                    value = f3->toString();
-                } else {
-                    value = deepestInternalNode->getValue()->value;
-                }
-            }
-
-            // if the internal node is *, multiply two leaf nodes
-            if (Token::Type::Mul == token->getType()) {
+            } else if (Token::Type::Mul == token->getType()) {
+                // if the internal node is *, multiply two leaf nodes
                 f3 = *f1 * *f2;
-                // if function is null, it is already reduced
-                if (f3) {
-                    value = f3->toString();
-                } else {
-                    value = deepestInternalNode->getValue()->value;
-                }
-            }
-
-            // if the internal node is /, divide two leaf nodes
-            if (Token::Type::Div == token->getType()) {
-                f3 = new Fraction(f1, f2);
-                dynamic_cast<Fraction *>(f3)->simplify();
-                // if function is null, it is already reduced
-                if (f3) {
-                    value = f3->toString();
-                } else {
-                    value = deepestInternalNode->getValue()->value;
-                }
-            }
-
-            // if the internal node is ^, get left^right
-            if (Token::Type::Power == token->getType()) {
+            } else if (Token::Type::Div == token->getType()) {
+                // if the internal node is /, divide two leaf nodes
+                auto *fraction = new Fraction(f1, f2);
+                fraction->simplify();
+                f3 = fraction;
+            } else if (Token::Type::Power == token->getType()) {
+                // if the internal node is ^, get left^right
                 f3 = f1->pow(f2);
-                // if function is null, it is already reduced
-                if (f3) {
-                    value = f3->toString();
-                } else {
-                    value = deepestInternalNode->getValue()->value;
-                }
             }
         }
     } catch (exception &e) {
@@ -329,8 +304,6 @@ void Interpreter::reduce() {
         throw std::runtime_error(error + e.what());
     }
 
-    Token *t = nullptr;
-
     // if node has a special op, this is the root node of the internal function
     if (deepestInternalNode->getSpecialOp()) {
         if (f3 && f3->isInputConstant()) {
@@ -340,21 +313,28 @@ void Interpreter::reduce() {
         deepestInternalNode->setFunction(f3);
     }
 
+    Token::Type type = token->getType();
     if (auto *f = deepestInternalNode->getFunction()) {
         // make a new number token
-        if (f->getType() == "Trig") {
-            t = new Token(Token::Type::Trig, value, -1);
-        } else if (f->getType() == "Log") {
-            t = new Token(Token::Type::Log, value, -1);
-        } else if (f->getType() == "Polynomial") {
-            t = new Token(Token::Type::Polynomial, value, -1);
-        } else {
-            t = new Token(Token::Type::Number, value, -1);
+        switch (f->getKind()) {
+            case Function::Kind::Trig:
+                type = Token::Type::Trig;
+                break;
+            case Function::Kind::Log:
+                type = Token::Type::Log;
+                break;
+            case Function::Kind::Polynomial:
+                type = Token::Type::Polynomial;
+                break;
+            default:
+                type = Token::Type::Number;
+                break;
         }
-    } else {
-        t = new Token(deepestInternalNode->getValue()->getType(), value, -1);
     }
 
+    // the token keeps the computed function, its text is only rendered for the steps
+    Token *t = f3 ? new Token(type, f3, -1) : new Token(type, token->value, -1);
+
     // remove the leaf nodes, change value to the computed number
     deepestInternalNode->setValue(t);
 
@@ -378,7 +358,7 @@ void Interpreter::simplify() const {
         double val = root->getFunction()->getValue();
         Function *c = new Constant(val);
         root->setFunction(c);
-        root->setValue(new Token(Token::Type::Number, Utilities::removeTrailingZeros(val), -1));
+        root->setValue(new Token(Token::Type::Number, c, -1));
         root->clearSpecialOp();
     }
 }
@@ -399,6 +379,8 @@ std::vector<string> Interpreter::getSteps() {
     steps.push_back(step);
 
 
+    buildSchedule();
+
     // loop until there is only one node remaining
     while (!root->reduced && !root->isLeaf()) {
         reduce();
@@ -461,41 +443,32 @@ std::vector<string> Interpreter::getSteps() {
  * @return the constant value of the function
  */
 double Interpreter::solve() {
-    std::vector<std::string> result = getSteps();
-    string answer = result.back();
-
-    size_t pos = answer.find('/');
-    // if the answer is a fraction turn that into a double
-    if (pos == 1) {
-        string num = answer.substr(0, pos);
-        string denom = answer.substr(pos + 1);
+    buildSchedule();
 
-        double numerator = stod(num, nullptr);
-        double denominator = stod(denom, nullptr);
+    // reduce like getSteps, without rendering the steps
+    while (!root->reduced && !root->isLeaf()) {
+        reduce();
+    }
+    if (root->isLeaf() && root->getSpecialOp() && root->getFunction()->isInputConstant()) {
+        simplify();
+    }
 
-        // return the double value of the fraction
-        return numerator / denominator;
-    } else {
-        return stod(answer, nullptr);
+    Function *answer = root->getFunction();
+    if (!answer || !answer->isInputConstant()) {
+        throw std::runtime_error("Expression does not reduce to a constant");
     }
+
+    // constants and fractions keep their full precision
+    return answer->getValue();
 }
 
 
 /**
  * get the vector of variable names for linear equations
- * @return the vector of variables
+ * @return the vector of variables, in the order of the columns of the augmented matrix
  */
-vector<char> Interpreter::getVariableNames() {
-    vector<char> variableNames;
-
-    for (auto const &currEquation: map) {
-        char variable = currEquation.first;
-        if (variable != 'C') {
-            variableNames.push_back(variable);
-        }
-    }
-
-    return variableNames;
+vector<string> Interpreter::getVariableNames() {
+    return linearSystem.getVariableNames();
 }
 
 
@@ -504,58 +477,5 @@ vector<char> Interpreter::getVariableNames() {
  * @return a vector of vector for double values
  */
 vector<vector<double>> Interpreter::getAugmentedMatrix() {
-    int i = 0, j = 0;
-    int rows = map['C'].size();
-    int cols = map.size();
-    vector<vector<double>> matrix(rows, vector<double>(cols));
-    for (auto const &currEquation: map) {
-        i = 0;
-        vector<double> coefs = currEquation.second;
-        for (double &coef: coefs) {
-            matrix.at(i).at(j) = coef;
-            i++;
-        }
-        j++;
-    }
-    return matrix;
+    return linearSystem.getAugmentedMatrix().toMatrix().getValues();
 }
-
-
-/**
- * search the tree for a linear equation and store the
- * coefficients and the variables in a hashmap.
- * @param node the tree to search for linear equation
- */
-void Interpreter::searchLinearEquation(Node *node) {
-    if (!node) {
-        return;
-    }
-
-    searchLinearEquation(node->getRight());
-    searchLinearEquation(node->getLeft());
-
-    if (node->getValue()->getType() == Token::Type::Polynomial) {
-        double coef = node->getFunction()->getCoef();
-        char variable = dynamic_cast<Polynomial *>(node->getFunction())->getVariable();
-        if (map.count(variable)) {
-            map[variable].push_back(coef);
-        } else {
-            vector<double> v;
-            v.push_back(coef);
-            map[variable] = v;
-        }
-    }
-
-    if (node->getValue()->getType() == Token::Type::Number) {
-        double coef = node->getFunction()->getCoef();
-        char variable = 'C';
-        if (map.count(variable)) {
-            map[variable].push_back(coef);
-        } else {
-            vector<double> v;
-            v.push_back(coef);
-            map[variable] = v;
-        }
-    }
-
-}
\ No newline at end of file
@@ -9,15 +9,63 @@
  * @version 1.0
  */
 
+#include <array>
 #include <stdexcept>
 #include "../../../include/model/analyser/Lexer.h"
+#include "../../../include/model/analyser/SymbolTable.h"
+
+namespace {
+    struct Keyword {
+        std::string_view name;
+        Token::Type type;
+    };
+
+    constexpr Keyword keywords[] = {
+            {"sin",  Token::Type::Trig},
+            {"cos",  Token::Type::Trig},
+            {"tan",  Token::Type::Trig},
+            {"log",  Token::Type::Log},
+            {"sqrt", Token::Type::Sqrt},
+            {"diff", Token::Type::Diff}
+    };
+
+    /**
+     * perfect hash of a word with at least two chars into the keyword table
+     * @param word the word to hash
+     * @return the slot of the word in the keyword table
+     */
+    constexpr std::size_t keywordSlot(std::string_view word) {
+        return (4 * word[0] + word[1] + word.length()) & 7;
+    }
+
+    constexpr std::array<Keyword, 8> makeKeywordTable() {
+        std::array<Keyword, 8> table{};
+        for (const Keyword &keyword: keywords) {
+            table[keywordSlot(keyword.name)] = keyword;
+        }
+        return table;
+    }
+
+    constexpr std::array<Keyword, 8> keywordTable = makeKeywordTable();
+
+    constexpr bool isPerfectHash() {
+        for (const Keyword &keyword: keywords) {
+            if (keywordTable[keywordSlot(keyword.name)].name != keyword.name) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert(isPerfectHash(), "two keywords hash to the same slot");
+}
 
 /**
  * constructor
  * @param inputExpr the user input expression
  */
 Lexer::Lexer(std::string inputExpr) {
-    expr = inputExpr;
+    expr = std::move(inputExpr);
     position = 0;
     currChar = expr[position];
 }
@@ -27,7 +75,9 @@ Lexer::Lexer(std::string inputExpr) {
  * @return a list of tokens
  */
 std::vector<Token> Lexer::tokenizer() {
+    // there is at most one token per char before the implicit ones are added
     std::vector<Token> list;
+    list.reserve(expr.length() + 1);
 
     auto t = getNextToken();
 
@@ -122,6 +172,15 @@ std::vector<Token> Lexer::tokenizer() {
     return list;
 }
 
+/**
+ * get the text of a lexeme in the input
+ * @param lexeme a lexeme from this lexer
+ * @return a view of the lexeme text, valid while the lexer is alive
+ */
+std::string_view Lexer::text(const Lexeme &lexeme) const {
+    return std::string_view(expr).substr(lexeme.offset, lexeme.length);
+}
+
 /**
  * get the next character in the string
  * if end of input is reached, set char to '\0'
@@ -209,6 +268,24 @@ bool Lexer::isVariable() const {
  * @return the next Token
  */
 Token Lexer::getNextToken() {
+    Lexeme lexeme = getNextLexeme();
+
+    // if end of file is reached, return the null Token
+    if (lexeme.type == Token::Type::EOI) {
+        return Token(Token::Type::EOI, "null", (int) lexeme.offset);
+    }
+    Token token(lexeme.type, std::string(text(lexeme)), (int) lexeme.offset);
+    if (lexeme.type == Token::Type::Variable) {
+        token.symbol = SymbolTable::intern(text(lexeme));
+    }
+    return token;
+}
+
+/**
+ * iterate the input and get the next Lexeme
+ * @return the next Lexeme
+ */
+Lexer::Lexeme Lexer::getNextLexeme() {
     try {
         // keep looping till end of file
         while (currChar != '\0') {
@@ -229,52 +306,52 @@ Token Lexer::getNextToken() {
                 return keyword();
             }
 
-            // if char is '=', return the Token
+            // if char is '=', return the Lexeme
             if (currChar == '=') {
                 nextChar();
-                return Token(Token::Type::Equal, "=", position - 1);
+                return {Token::Type::Equal, (std::size_t) position - 1, 1};
             }
 
-            // if char is '+', return the Token
+            // if char is '+', return the Lexeme
             if (currChar == '+') {
                 nextChar();
-                return Token(Token::Type::Plus, "+", position - 1);
+                return {Token::Type::Plus, (std::size_t) position - 1, 1};
             }
 
-            // if char is '-', return the Token
+            // if char is '-', return the Lexeme
             if (currChar == '-') {
                 nextChar();
-                return Token(Token::Type::Minus, "-", position - 1);
+                return {Token::Type::Minus, (std::size_t) position - 1, 1};
             }
 
-            // if char is '*', return the Token
+            // if char is '*', return the Lexeme
             if (currChar == '*') {
                 nextChar();
-                return Token(Token::Type::Mul, "*", position - 1);
+                return {Token::Type::Mul, (std::size_t) position - 1, 1};
             }
 
-            // if char is '/', return the Token
+            // if char is '/', return the Lexeme
             if (currChar == '/') {
                 nextChar();
-                return Token(Token::Type::Div, "/", position - 1);
+                return {Token::Type::Div, (std::size_t) position - 1, 1};
             }
 
-            // if char is '^', return the Token
+            // if char is '^', return the Lexeme
             if (currChar == '^') {
                 nextChar();
-                return Token(Token::Type::Power, "^", position - 1);
+                return {Token::Type::Power, (std::size_t) position - 1, 1};
             }
 
-            // if char is '(', return the Token
+            // if char is '(', return the Lexeme
             if (currChar == '(') {
                 nextChar();
-                return Token(Token::Type::LParen, "(", position - 1);
+                return {Token::Type::LParen, (std::size_t) position - 1, 1};
             }
 
-            // if char is ')', return the Token
+            // if char is ')', return the Lexeme
             if (currChar == ')') {
                 nextChar();
-                return Token(Token::Type::RParen, ")", position - 1);
+                return {Token::Type::RParen, (std::size_t) position - 1, 1};
             }
 
             // for any other case, return an error
@@ -284,8 +361,8 @@ Token Lexer::getNextToken() {
             throw std::runtime_error(error);
         }
 
-        // if end of file is reached, return the null Token
-        return Token(Token::Type::EOI, "null", position);
+        // if end of file is reached, return the null Lexeme
+        return {Token::Type::EOI, (std::size_t) position, 0};
 
     } catch (const std::exception &e) {
         throw std::runtime_error(e.what());
@@ -294,56 +371,54 @@ Token Lexer::getNextToken() {
 
 
 /**
- * check for consecutive digits and return them as a Token
- * @return a number Token
+ * check for consecutive digits and return them as a Lexeme
+ * @return a number Lexeme
  */
-Token Lexer::number_factorial() {
-    std::string result;
+Lexer::Lexeme Lexer::number_factorial() {
+    std::size_t start = position;
 
     // keep looping until EOF or next non-digit char
     while (currChar != '\0' && (isDigit() || currChar == '.')) {
-        result += currChar;
         nextChar();
     }
 
     // if number ends with '.', it is invalid
-    if (result.back() == '.') {
+    if (expr[position - 1] == '.') {
         throw std::runtime_error("Invalid number");
     }
 
-    // check if the next char is !, return a factorial token instead
+    // check if the next char is !, return a factorial lexeme instead
     if (currChar == '!') {
-        result += currChar;
         nextChar();
-        return Token(Token::Type::Factorial, result, (position - result.length()));
+        return {Token::Type::Factorial, start, position - start};
     }
 
-    return Token(Token::Type::Number, result, (position - result.length()));
+    return {Token::Type::Number, start, position - start};
 }
 
 
 /**
  * check for consecutive characters
- * chars have to be trig names or single variables
- * @return a variable or trig Token
+ * a word that is not a function name is a variable, which starts with a
+ * letter and may go on with letters and digits, e.g. "x", "rate" or "x12"
+ * @return a variable or trig Lexeme
  */
-Token Lexer::keyword() {
-    std::string result;
-    while (currChar != '\0' && isVariable()) {
-        result += currChar;
+Lexer::Lexeme Lexer::keyword() {
+    std::size_t start = position;
+    while (currChar != '\0' && (isVariable() || isDigit())) {
         nextChar();
     }
-    if (result == "sin" || result == "cos" || result == "tan") {
-        return Token(Token::Type::Trig, result, (position - result.length()));
-    } else if (result == "log") {
-        return Token(Token::Type::Log, result, (position - result.length()));
-    } else if (result == "sqrt") {
-        return Token(Token::Type::Sqrt, result, (position - result.length()));
-    } else if (result == "diff") {
-        return Token(Token::Type::Diff, result, (position - result.length()));
-    } else if (result.length() == 1) {
-        return Token(Token::Type::Variable, result, position - 1);
-    } else {
-        throw std::runtime_error("Invalid variable name");
+    std::size_t length = position - start;
+    std::string_view word(expr.data() + start, length);
+
+    if (length == 1) {
+        return {Token::Type::Variable, start, length};
     }
-}
\ No newline at end of file
+
+    // look the word up in the keyword table
+    const Keyword &keyword = keywordTable[keywordSlot(word)];
+    if (keyword.name == word) {
+        return {keyword.type, start, length};
+    }
+    return {Token::Type::Variable, start, length};
+}
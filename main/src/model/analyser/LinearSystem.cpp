@@ -0,0 +1,322 @@
+/**
+ * @brief This class collects linear equations into an augmented matrix.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "../../../include/model/analyser/LinearSystem.h"
+#include "../../../include/model/analyser/SymbolTable.h"
+#include "../../../include/model/analyser/Token.h"
+#include "../../../include/model/functions/Factorial.h"
+#include "../../../include/model/functions/Log.h"
+#include "../../../include/model/functions/Polynomial.h"
+#include "../../../include/model/functions/Trig.h"
+
+namespace {
+    const char *notLinear = "The equations must be linear";
+}
+
+
+/**
+ * add an equation to the system, an expression without '=' is taken as equal to 0
+ * @param equation the root of the parse tree of the equation
+ */
+void LinearSystem::addEquation(Node *equation) {
+    constant = 0;
+    if (equation->getValue()->getType() == Token::Type::Equal) {
+        // left - right = 0
+        collect(equation->getLeft(), 1);
+        collect(equation->getRight(), -1);
+    } else {
+        collect(equation, 1);
+    }
+
+    // the constant moves to the right hand side
+    constants.push_back(-constant);
+    for (int i = rowStart.back(); i < (int) terms.size(); i++) {
+        position[terms[i].variable] = -1;
+    }
+    rowStart.push_back(terms.size());
+}
+
+
+/**
+ * add the equations of another system after the ones of this system
+ * @param other the system to copy the equations from
+ */
+void LinearSystem::append(const LinearSystem &other) {
+    std::vector<int> index(other.symbols.size());
+    for (int i = 0; i < (int) other.symbols.size(); i++) {
+        index[i] = indexOf(other.symbols[i]);
+    }
+
+    int offset = terms.size();
+    for (const Term &term: other.terms) {
+        terms.push_back({index[term.variable], term.coefficient});
+    }
+    for (int i = 1; i < (int) other.rowStart.size(); i++) {
+        rowStart.push_back(offset + other.rowStart[i]);
+    }
+    constants.insert(constants.end(), other.constants.begin(), other.constants.end());
+}
+
+
+/**
+ * get the number of equations added so far
+ * @return the number of equations
+ */
+int LinearSystem::getEquations() const {
+    return constants.size();
+}
+
+
+/**
+ * get the variables of the system, in the order of the columns of the augmented matrix
+ * @return the variable names in natural order
+ */
+std::vector<std::string> LinearSystem::getVariableNames() const {
+    std::vector<int> columns = getColumns();
+    std::vector<std::string> sorted(symbols.size());
+    for (int i = 0; i < (int) symbols.size(); i++) {
+        sorted[columns[i]] = SymbolTable::name(symbols[i]);
+    }
+    return sorted;
+}
+
+
+/**
+ * get the augmented matrix of the system
+ * @return one row per equation, one column per variable and the constants in the last column
+ */
+SparseMatrix LinearSystem::getAugmentedMatrix() const {
+    std::vector<int> column = getColumns();
+
+    std::vector<SparseMatrix::Entry> entries;
+    entries.reserve(terms.size() + constants.size());
+    for (int row = 0; row < getEquations(); row++) {
+        for (int i = rowStart[row]; i < rowStart[row + 1]; i++) {
+            entries.push_back({row, column[terms[i].variable], terms[i].coefficient});
+        }
+        entries.push_back({row, (int) symbols.size(), constants[row]});
+    }
+    return SparseMatrix(getEquations(), symbols.size() + 1, entries);
+}
+
+
+/**
+ * get the column of each variable, sorting by name only happens here
+ * @return the column of the variable with each index
+ */
+std::vector<int> LinearSystem::getColumns() const {
+    std::vector<int> order(symbols.size());
+    for (int i = 0; i < (int) order.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return SymbolTable::naturalLess(symbols[a], symbols[b]);
+    });
+
+    std::vector<int> column(symbols.size());
+    for (int i = 0; i < (int) order.size(); i++) {
+        column[order[i]] = i;
+    }
+    return column;
+}
+
+
+/**
+ * add scale times the linear form of a subtree to the current equation
+ * @param node the subtree
+ * @param scale the factor the subtree is multiplied by in the equation
+ */
+void LinearSystem::collect(Node *node, double scale) {
+    if (!node) {
+        return;
+    }
+
+    double value;
+    if (node->getSpecialOp()) {
+        // sin, log and sqrt are only linear of a number
+        if (!isConstant(node, value)) {
+            throw std::runtime_error(notLinear);
+        }
+        constant += scale * value;
+        return;
+    }
+
+    Token *token = node->getValue();
+    switch (token->getType()) {
+        case Token::Type::Number:
+        case Token::Type::Factorial:
+            isConstant(node, value);
+            constant += scale * value;
+            break;
+        case Token::Type::Variable:
+            addTerm(token->symbol, scale);
+            break;
+        case Token::Type::Polynomial: {
+            auto *polynomial = static_cast<Polynomial *>(node->getFunction());
+            if (polynomial->getPower() != 1) {
+                throw std::runtime_error(notLinear);
+            }
+            addTerm(polynomial->getVariable(), scale * polynomial->getCoef());
+            break;
+        }
+        case Token::Type::Plus:
+            collect(node->getLeft(), scale);
+            collect(node->getRight(), scale);
+            break;
+        case Token::Type::Minus:
+            // a leading '-' has only a left child, which it negates
+            if (!node->getRight()) {
+                collect(node->getLeft(), -scale);
+                break;
+            }
+            collect(node->getLeft(), scale);
+            collect(node->getRight(), -scale);
+            break;
+        case Token::Type::Mul:
+            // one side has a variable, so the other has to be a number
+            if (isConstant(node->getLeft(), value)) {
+                collect(node->getRight(), scale * value);
+            } else if (isConstant(node->getRight(), value)) {
+                collect(node->getLeft(), scale * value);
+            } else {
+                throw std::runtime_error(notLinear);
+            }
+            break;
+        case Token::Type::Div:
+            if (!isConstant(node->getRight(), value)) {
+                throw std::runtime_error(notLinear);
+            }
+            if (value == 0) {
+                throw std::runtime_error("Division by zero");
+            }
+            collect(node->getLeft(), scale / value);
+            break;
+        case Token::Type::Power:
+            // x^1 is the only power of a variable that is linear
+            if (!isConstant(node->getRight(), value)) {
+                throw std::runtime_error(notLinear);
+            }
+            if (value == 1) {
+                collect(node->getLeft(), scale);
+            } else if (isConstant(node, value)) {
+                constant += scale * value;
+            } else {
+                throw std::runtime_error(notLinear);
+            }
+            break;
+        default:
+            throw std::runtime_error(notLinear);
+    }
+}
+
+
+/**
+ * add a multiple of a variable to the current equation
+ * @param symbol the SymbolTable id of the variable
+ * @param coefficient the multiple
+ */
+void LinearSystem::addTerm(int symbol, double coefficient) {
+    int index = indexOf(symbol);
+    if (position[index] == -1) {
+        position[index] = terms.size();
+        terms.push_back({index, coefficient});
+    } else {
+        terms[position[index]].coefficient += coefficient;
+    }
+}
+
+
+/**
+ * get the index of a variable, giving it the next one if it is new
+ * @param symbol the SymbolTable id of the variable
+ * @return the index of the variable
+ */
+int LinearSystem::indexOf(int symbol) {
+    if (symbol >= (int) indices.size()) {
+        indices.resize(symbol + 1, -1);
+    }
+    if (indices[symbol] == -1) {
+        indices[symbol] = symbols.size();
+        symbols.push_back(symbol);
+        position.push_back(-1);
+    }
+    return indices[symbol];
+}
+
+
+/**
+ * compute the value of a subtree if it has no variables
+ * @param node the subtree
+ * @param value set to the value of the subtree if it is constant
+ * @return true if the subtree is constant
+ */
+bool LinearSystem::isConstant(Node *node, double &value) {
+    if (!node) {
+        return false;
+    }
+
+    Token *token = node->getValue();
+    double left, right;
+    switch (token->getType()) {
+        case Token::Type::Number:
+            value = std::stod(token->value);
+            break;
+        case Token::Type::Factorial:
+            value = Factorial::factorial(std::stoi(token->value));
+            break;
+        case Token::Type::Plus:
+        case Token::Type::Minus:
+        case Token::Type::Mul:
+        case Token::Type::Div:
+        case Token::Type::Power:
+            if (token->getType() == Token::Type::Minus && node->getLeft() && !node->getRight()) {
+                if (!isConstant(node->getLeft(), left)) {
+                    return false;
+                }
+                value = -left;
+                break;
+            }
+            if (!isConstant(node->getLeft(), left) || !isConstant(node->getRight(), right)) {
+                return false;
+            }
+            if (token->getType() == Token::Type::Plus) {
+                value = left + right;
+            } else if (token->getType() == Token::Type::Minus) {
+                value = left - right;
+            } else if (token->getType() == Token::Type::Mul) {
+                value = left * right;
+            } else if (token->getType() == Token::Type::Div) {
+                if (right == 0) {
+                    throw std::runtime_error("Division by zero");
+                }
+                value = left / right;
+            } else {
+                value = std::pow(left, right);
+            }
+            break;
+        default:
+            return false;
+    }
+
+    // the special operation applies to the whole subtree
+    if (Token *specialOp = node->getSpecialOp()) {
+        if (specialOp->getType() == Token::Type::Trig) {
+            value = Trig(value, specialOp->value, 1, 1).getValue();
+        } else if (specialOp->getType() == Token::Type::Log) {
+            value = Log(value, 10, 1, 1).getValue();
+        } else if (specialOp->getType() == Token::Type::Sqrt) {
+            value = std::sqrt(value);
+        } else {
+            throw std::runtime_error(notLinear);
+        }
+    }
+    return true;
+}
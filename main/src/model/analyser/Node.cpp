@@ -11,6 +11,7 @@
 #include <string>
 
 #include "../../../include/model/analyser/Node.h"
+#include "../../../include/model/analyser/ParseSession.h"
 
 /**
  * @brief Construct a new Node
@@ -41,6 +42,25 @@ Node::Node(const Node &n) {
     function = nullptr;
 }
 
+/**
+ * @brief allocate a Node from the open ParseSession, or the heap if there is none
+ *
+ * @param size -> the size of the node
+ * @return the memory for the node
+ */
+void *Node::operator new(std::size_t size) {
+    return ParseSession::allocate(size, ParseSession::Kind::Node);
+}
+
+/**
+ * @brief release a Node, session memory is reclaimed when the session closes
+ *
+ * @param pointer -> the memory of the node
+ */
+void Node::operator delete(void *pointer) {
+    ParseSession::release(pointer);
+}
+
 /**
  * @brief get the node stored left of this node
  * 
@@ -188,7 +208,7 @@ std::string Node::toString() {
         if (getFunction()) {
             result += getFunction()->toString();
         } else {
-            result += this->getValue()->value;
+            result += this->getValue()->getText();
         }
     } else {
         if (this->getLeft()) {
@@ -198,7 +218,7 @@ std::string Node::toString() {
         if (getFunction()) {
             result += getFunction()->toString(); // 1*cos(
         } else {
-            result += this->getValue()->value;
+            result += this->getValue()->getText();
         }
 
         if (this->getRight()) {
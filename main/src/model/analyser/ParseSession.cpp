@@ -0,0 +1,198 @@
+/**
+ * @brief This class owns every AST and Function object of one evaluation.
+ *
+ * @details While a ParseSession is open, every Node, Token and Function
+ * created on the same thread is bump allocated from the session's memory
+ * blocks instead of the heap. Closing the session destroys the objects
+ * that are still alive and releases all of the blocks in one step, so
+ * parsing and interpreting an expression no longer leaks its tree.
+ * Objects created while no session is open come from the heap as before.
+ * Sessions can be nested, the innermost one is used.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <new>
+
+#include "../../../include/model/analyser/ParseSession.h"
+#include "../../../include/model/analyser/Node.h"
+#include "../../../include/model/analyser/Token.h"
+#include "../../../include/model/functions/Function.h"
+
+// size of a memory block, larger objects get a block of their own
+static const std::size_t BLOCK_SIZE = 16 * 1024;
+
+/**
+ * bookkeeping placed in front of every object, heap objects have one too
+ * so that release() can tell them apart from session objects
+ */
+struct alignas(std::max_align_t) ParseSession::Record {
+    Record *next;
+    Kind kind;
+    // false once the object is deleted or its constructor threw
+    bool live;
+    // false for objects allocated on the heap
+    bool owned;
+};
+
+static thread_local ParseSession *currentSession = nullptr;
+
+
+/**
+ * open a session, it is used by this thread until it is destroyed
+ */
+ParseSession::ParseSession() {
+    records = nullptr;
+    cursor = nullptr;
+    remaining = 0;
+    allocationCount = 0;
+    bytesAllocated = 0;
+
+    previous = currentSession;
+    currentSession = this;
+}
+
+
+/**
+ * close the session, destroy the objects that are still alive and release the memory
+ */
+ParseSession::~ParseSession() {
+    // the newest objects are destroyed first
+    for (Record *record = records; record; record = record->next) {
+        if (!record->live) {
+            continue;
+        }
+        void *object = record + 1;
+        switch (record->kind) {
+            case Kind::Node:
+                static_cast<Node *>(object)->~Node();
+                break;
+            case Kind::Token:
+                static_cast<Token *>(object)->~Token();
+                break;
+            case Kind::Function:
+                static_cast<Function *>(object)->~Function();
+                break;
+        }
+    }
+
+    for (char *block: blocks) {
+        ::operator delete(block);
+    }
+
+    currentSession = previous;
+}
+
+
+/**
+ * get the session of this thread
+ * @return the innermost open session, nullptr if there is none
+ */
+ParseSession *ParseSession::current() {
+    return currentSession;
+}
+
+
+/**
+ * allocate memory for an object, from the current session if one is open
+ * @param size the size of the object
+ * @param kind the class of the object, used to destroy it with the session
+ * @return the memory for the object
+ */
+void *ParseSession::allocate(std::size_t size, Kind kind) {
+    ParseSession *session = currentSession;
+
+    Record *record;
+    if (session) {
+        record = static_cast<Record *>(session->bump(sizeof(Record) + size));
+        record->next = session->records;
+        session->records = record;
+    } else {
+        record = static_cast<Record *>(::operator new(sizeof(Record) + size));
+        record->next = nullptr;
+    }
+
+    record->kind = kind;
+    record->live = true;
+    record->owned = session != nullptr;
+    return record + 1;
+}
+
+
+/**
+ * release an object after its destructor ran. Session memory is only
+ * given back when the session closes.
+ * @param object the object returned by allocate()
+ */
+void ParseSession::release(void *object) {
+    if (!object) {
+        return;
+    }
+
+    Record *record = static_cast<Record *>(object) - 1;
+    if (record->owned) {
+        record->live = false;
+    } else {
+        ::operator delete(record);
+    }
+}
+
+
+/**
+ * getter method for the number of objects allocated by the session
+ * @return the number of allocations
+ */
+std::size_t ParseSession::getAllocationCount() const {
+    return allocationCount;
+}
+
+
+/**
+ * getter method for the memory handed out by the session
+ * @return the number of bytes, including bookkeeping
+ */
+std::size_t ParseSession::getBytesAllocated() const {
+    return bytesAllocated;
+}
+
+
+/**
+ * getter method for the number of memory blocks of the session
+ * @return the number of blocks
+ */
+std::size_t ParseSession::getBlockCount() const {
+    return blocks.size();
+}
+
+
+/**
+ * take memory from the current block, starting a new block when it is full
+ * @param size the number of bytes
+ * @return the memory, aligned like the heap would align it
+ */
+void *ParseSession::bump(std::size_t size) {
+    const std::size_t alignment = alignof(std::max_align_t);
+    size = (size + alignment - 1) / alignment * alignment;
+
+    allocationCount++;
+    bytesAllocated += size;
+
+    if (size > BLOCK_SIZE / 4) {
+        // keep the current block for the small objects that follow
+        char *block = static_cast<char *>(::operator new(size));
+        blocks.push_back(block);
+        return block;
+    }
+
+    if (size > remaining) {
+        cursor = static_cast<char *>(::operator new(BLOCK_SIZE));
+        remaining = BLOCK_SIZE;
+        blocks.push_back(cursor);
+    }
+
+    void *memory = cursor;
+    cursor += size;
+    remaining -= size;
+    return memory;
+}
@@ -96,36 +96,6 @@ std::tuple<Node *, Token *> Parser::factorialSubTree(Token *t) {
 
 }
 
-/**
- * @brief 
- * Recursive function which goes through the parser trees and frees the nodes as a way of implementing garabage collection
- * @param r -> root node of the subTree that will be freed
- */
-void Parser::freeTree(Node *r) {
-    if (r == nullptr) {
-        return;
-    }
-
-    if (r->isLeaf()) {
-        free(r->getSpecialOp());
-        free(r->getFunction());
-        free(r->getValue());
-        free(r);
-        return;
-    }
-
-
-    freeTree(r->getLeft());
-
-    freeTree(r->getRight());
-
-    free(r->getSpecialOp());
-    free(r->getFunction());
-    free(r->getValue());
-
-    free(r);
-}
-
 /**
  * @brief 
  * 
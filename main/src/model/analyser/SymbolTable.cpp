@@ -0,0 +1,118 @@
+/**
+ * @brief This class gives every variable name a small integer id.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "../../../include/model/analyser/SymbolTable.h"
+
+namespace {
+    struct Table {
+        std::shared_mutex mutex;
+        // a deque never moves its strings, so the views in ids stay valid
+        std::deque<std::string> names;
+        std::unordered_map<std::string_view, int> ids;
+    };
+
+    Table &table() {
+        static Table instance;
+        return instance;
+    }
+
+    /**
+     * split a name into its letters and the number that ends it, "x12" -> "x", 12
+     */
+    void splitName(const std::string &name, std::string_view &letters, unsigned long long &number, bool &hasNumber) {
+        std::size_t end = name.size();
+        while (end > 0 && name[end - 1] >= '0' && name[end - 1] <= '9') {
+            end--;
+        }
+        letters = std::string_view(name).substr(0, end);
+        hasNumber = end < name.size() && name.size() - end < 20;
+        number = hasNumber ? std::stoull(name.substr(end)) : 0;
+    }
+}
+
+
+/**
+ * get the id of a name, adding it to the table if it is new
+ * @param name the variable name
+ * @return the id of the name
+ */
+int SymbolTable::intern(std::string_view name) {
+    Table &symbols = table();
+    {
+        std::shared_lock<std::shared_mutex> lock(symbols.mutex);
+        auto found = symbols.ids.find(name);
+        if (found != symbols.ids.end()) {
+            return found->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(symbols.mutex);
+    // another thread may have added it in the mean time
+    auto found = symbols.ids.find(name);
+    if (found != symbols.ids.end()) {
+        return found->second;
+    }
+    int symbol = symbols.names.size();
+    symbols.names.emplace_back(name);
+    symbols.ids.emplace(symbols.names.back(), symbol);
+    return symbol;
+}
+
+
+/**
+ * get the name of an id
+ * @param symbol an id returned by intern
+ * @return the name, valid for the life of the program
+ */
+const std::string &SymbolTable::name(int symbol) {
+    Table &symbols = table();
+    std::shared_lock<std::shared_mutex> lock(symbols.mutex);
+    if (symbol < 0 || symbol >= (int) symbols.names.size()) {
+        throw std::runtime_error("Unknown variable");
+    }
+    return symbols.names[symbol];
+}
+
+
+/**
+ * get the number of names in the table
+ * @return the number of names, every id is less than it
+ */
+int SymbolTable::size() {
+    Table &symbols = table();
+    std::shared_lock<std::shared_mutex> lock(symbols.mutex);
+    return symbols.names.size();
+}
+
+
+/**
+ * order two names alphabetically, but with the numbers at their ends by value
+ * @details x2 comes before x10, so the unknowns of a generated system stay in order
+ * @param a the id of the first name
+ * @param b the id of the second name
+ * @return true if a comes before b
+ */
+bool SymbolTable::naturalLess(int a, int b) {
+    std::string_view lettersA, lettersB;
+    unsigned long long numberA, numberB;
+    bool hasNumberA, hasNumberB;
+    splitName(name(a), lettersA, numberA, hasNumberA);
+    splitName(name(b), lettersB, numberB, hasNumberB);
+    if (lettersA != lettersB) {
+        return lettersA < lettersB;
+    }
+    if (hasNumberA != hasNumberB || numberA != numberB) {
+        return hasNumberA < hasNumberB || (hasNumberA && numberA < numberB);
+    }
+    return name(a) < name(b);
+}
@@ -5,22 +5,37 @@
  * its value in a string form and its position in the given input string.
  * This class is used by the lexer to generate a set of tokens from the
  * input string and by the parser to create parse trees.
+ * Tokens made by the interpreter carry the computed Function instead of
+ * a string, it is only rendered when the text is needed.
  *
  * @author Mihir Kadiya
  */
 
 #include "../../../include/model/analyser/Token.h"
+#include "../../../include/model/analyser/ParseSession.h"
+#include "../../../include/model/functions/Function.h"
 
 Token::Token(Token::Type type, std::string value, int position) {
     Token::type = type;
     Token::value = value;
+    Token::function = nullptr;
     Token::position = position;
+    Token::symbol = -1;
+}
+
+Token::Token(Token::Type type, Function *function, int position) {
+    Token::type = type;
+    Token::function = function;
+    Token::position = position;
+    Token::symbol = -1;
 }
 
 Token::Token(const Token &n) {
     Token::type = n.type;
     Token::value = n.value;
+    Token::function = n.function;
     Token::position = n.position;
+    Token::symbol = n.symbol;
 }
 
 Token::Type Token::getType() const {
@@ -35,6 +50,14 @@ bool Token::equals(Type type) const {
     return Token::type == type;
 }
 
+std::string Token::getText() const {
+    return function ? function->toString() : value;
+}
 
+void *Token::operator new(std::size_t size) {
+    return ParseSession::allocate(size, ParseSession::Kind::Token);
+}
 
-
+void Token::operator delete(void *pointer) {
+    ParseSession::release(pointer);
+}
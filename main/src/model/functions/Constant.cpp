@@ -17,8 +17,7 @@
 #include "../../../include/model/functions/Fraction.h"
 #include "../../../include/model/functions/Polynomial.h"
 
-Constant::Constant(double newValue) {
-    Function::type = "Constant";
+Constant::Constant(double newValue) : Function(Kind::Constant) {
     Constant::value = newValue;
 }
 
@@ -49,156 +48,184 @@ void Constant::setValue(double newValue) {
 }
 
 Function* Constant::add(Function *f) {
-    // if the function is a constant
-    if (auto *c = dynamic_cast<Constant*>(f)) {
-        double newConst = getValue() + c->getValue();
-        Function *newF = new Constant(newConst);
-        return newF;
-    }
-
-    // if the function is a trig
-    if (auto *t = dynamic_cast<Trig*>(f)) {
-        if (!t->getNodeInput()) {
-            Function *c = new Constant(getValue() + t->getValue());
-            return c;
+    switch (f->getKind()) {
+        // if the function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            double newConst = getValue() + c->getValue();
+            Function *newF = new Constant(newConst);
+            return newF;
         }
-    }
-
-    // if the function is a log
-    if (auto *l = dynamic_cast<Log*>(f)) {
-        if (!l->getNodeInput()) {
-            Function *c = new Constant(getValue() + l->getValue());
-            return c;
+        // if the function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            if (!t->getNodeInput()) {
+                Function *c = new Constant(getValue() + t->getValue());
+                return c;
+            }
+            break;
         }
-    }
-
-    // if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial*>(f)) {
-        return p->add(this);
-    }
-
-    // if the function is a fraction
-    if(auto *frac = dynamic_cast<Fraction*>(f)) {
-        Function *cToF = Fraction::to_fraction(this);
-        return *cToF + *frac;
+        // if the function is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            if (!l->getNodeInput()) {
+                Function *c = new Constant(getValue() + l->getValue());
+                return c;
+            }
+            break;
+        }
+        // if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            return p->add(this);
+        }
+        // if the function is a fraction
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            Function *cToF = Fraction::to_fraction(this);
+            return *cToF + *frac;
+        }
+        default:
+            break;
     }
 
     return nullptr;
 }
 
 Function* Constant::subtract(Function *f) {
-    // if the function is a constant
-    if (auto *c = dynamic_cast<Constant*>(f)) {
-        double newConst = getValue() - c->getValue();
-        Function *newF = new Constant(newConst);
-        return newF;
-    }
-
-    // if the function is a trig
-    if (auto *t = dynamic_cast<Trig*>(f)) {
-        if (!t->getNodeInput()) {
-            Function *c = new Constant(getValue() - t->getValue());
-            return c;
+    switch (f->getKind()) {
+        // if the function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            double newConst = getValue() - c->getValue();
+            Function *newF = new Constant(newConst);
+            return newF;
         }
-    }
-
-    // if the function is a log
-    if (auto *l = dynamic_cast<Log*>(f)) {
-        if (!l->getNodeInput()) {
-            Function *c = new Constant(getValue() - l->getValue());
-            return c;
+        // if the function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            if (!t->getNodeInput()) {
+                Function *c = new Constant(getValue() - t->getValue());
+                return c;
+            }
+            break;
         }
-    }
-
-    // if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial*>(f)) {
-        Function *poly = new Polynomial(getValue(), p->getVariable(), 0);
-        return poly->subtract(p);
-    }
-
-    // if the function is a fraction
-    if(auto *frac = dynamic_cast<Fraction*>(f)) {
-        Function *cToF = Fraction::to_fraction(this);
-        return *cToF - *frac;
+        // if the function is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            if (!l->getNodeInput()) {
+                Function *c = new Constant(getValue() - l->getValue());
+                return c;
+            }
+            break;
+        }
+        // if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            Function *poly = new Polynomial(getValue(), p->getVariable(), 0);
+            return poly->subtract(p);
+        }
+        // if the function is a fraction
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            Function *cToF = Fraction::to_fraction(this);
+            return *cToF - *frac;
+        }
+        default:
+            break;
     }
 
     return nullptr;
 }
 
 Function* Constant::multiply(Function *f) {
-    // if the function is a constant
-    if (auto *c = dynamic_cast<Constant*>(f)) {
-        double newConst = getValue() * c->getValue();
-        Function *newF = new Constant(newConst);
-        return newF;
-    }
-
-    // if the function is a trig
-    if (auto *t = dynamic_cast<Trig*>(f)) {
-        if (!t->getNodeInput()) {
-            Function *c = new Constant(getValue() * t->getValue());
-            return c;
-        } else {
-            Function *trig = new Trig(t->getNodeInput(), t->getTrigType(),
-                                      getValue() * t->getCoef(), t->getPower());
-            return trig;
+    switch (f->getKind()) {
+        // if the function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            double newConst = getValue() * c->getValue();
+            Function *newF = new Constant(newConst);
+            return newF;
         }
-    }
-
-    // if the function is a log
-    if (auto *l = dynamic_cast<Log*>(f)) {
-        if (!l->getNodeInput()) {
-            Function *c = new Constant(getValue() * l->getValue());
-            return c;
-        } else {
-            Function *log = new Log(l->getNodeInput(), l->getBase(),
-                                    getValue() * l->getCoef(), l->getPower());
-            return log;
+        // if the function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            if (!t->getNodeInput()) {
+                Function *c = new Constant(getValue() * t->getValue());
+                return c;
+            } else {
+                Function *trig = new Trig(t->getNodeInput(), t->getTrigType(),
+                                          getValue() * t->getCoef(), t->getPower());
+                return trig;
+            }
+            break;
         }
-    }
-
-    // if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial*>(f)) {
-        return p->multiply(this);
-    }
-
-    // if the function is a fraction
-    if(auto *frac = dynamic_cast<Fraction*>(f)) {
-        Function *cToF = Fraction::to_fraction(this);
-        return *cToF * *frac;
+        // if the function is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            if (!l->getNodeInput()) {
+                Function *c = new Constant(getValue() * l->getValue());
+                return c;
+            } else {
+                Function *log = new Log(l->getNodeInput(), l->getBase(),
+                                        getValue() * l->getCoef(), l->getPower());
+                return log;
+            }
+            break;
+        }
+        // if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            return p->multiply(this);
+        }
+        // if the function is a fraction
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            Function *cToF = Fraction::to_fraction(this);
+            return *cToF * *frac;
+        }
+        default:
+            break;
     }
 
     return nullptr;
 }
 
 Function *Constant::pow(Function *f) {
-    // if the function is a constant
-    if (auto *c = dynamic_cast<Constant*>(f)) {
-        double newConst = std::pow(getValue(), c->getValue());
-        Function *newF = new Constant(newConst);
-        return newF;
-    }
-
-    // if the function is a trig
-    if (auto *t = dynamic_cast<Trig*>(f)) {
-        if (!t->getNodeInput()) {
-            Function *c = new Constant(std::pow(getValue(), t->getValue()));
-            return c;
+    switch (f->getKind()) {
+        // if the function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            double newConst = std::pow(getValue(), c->getValue());
+            Function *newF = new Constant(newConst);
+            return newF;
         }
-    }
-
-    // if the function is a log
-    if (auto *l = dynamic_cast<Log*>(f)) {
-        if (!l->getNodeInput()) {
-            Function *c = new Constant(std::pow(getValue(), l->getValue()));
+        // if the function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            if (!t->getNodeInput()) {
+                Function *c = new Constant(std::pow(getValue(), t->getValue()));
+                return c;
+            }
+            break;
+        }
+        // if the function is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            if (!l->getNodeInput()) {
+                Function *c = new Constant(std::pow(getValue(), l->getValue()));
+                return c;
+            }
+            break;
+        }
+        // if the function is a fraction
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            Function *c = new Constant(std::pow(getValue(), frac->getValue()));
             return c;
         }
-    }
-
-    // if the function is a fraction
-    if (auto *frac = dynamic_cast<Fraction*>(f)) {
-        Function *c = new Constant(std::pow(getValue(), frac->getValue()));
-        return c;
+        default:
+            break;
     }
 
     return nullptr;
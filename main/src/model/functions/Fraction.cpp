@@ -27,10 +27,9 @@
  * @param numerator the numerator part of fraction
  * @param denominator the denominator part of fraction
  */
-Fraction::Fraction(Function *numerator, Function *denominator) {
+Fraction::Fraction(Function *numerator, Function *denominator) : Function(Kind::Fraction) {
     Fraction::numerator = numerator;
     Fraction::denominator = denominator;
-    Function::type = "Fraction";
 
     // denominator should not be 0
     if (Fraction::denominator->toString() == "0") {
@@ -111,22 +110,25 @@ void Fraction::simplify() {
                 }
             }
 
-            if (auto *pNum = dynamic_cast<Polynomial *>(numerator)) {
-                pNum->minimizeCoef(gcfCoef);
+            if (numerator->getKind() == Kind::Polynomial) {
+                static_cast<Polynomial *>(numerator)->minimizeCoef(gcfCoef);
             } else {
                 numerator->setCoef(numeratorCoef / gcfCoef);
             }
-            if (auto *pDem = dynamic_cast<Polynomial *>(denominator)) {
-                pDem->minimizeCoef(gcfCoef);
+            if (denominator->getKind() == Kind::Polynomial) {
+                static_cast<Polynomial *>(denominator)->minimizeCoef(gcfCoef);
             } else {
                 denominator->setCoef(denominatorCoef / gcfCoef);
             }
         }
 
 
-        if (numerator->getType() == denominator->getType()) {
-            if (auto *tNum = dynamic_cast<Trig *>(numerator)) {
-                if (auto *tDen = dynamic_cast<Trig *>(denominator)) {
+        // both functions are the same type, so only the numerator is switched on
+        if (numerator->getKind() == denominator->getKind()) {
+            switch (numerator->getKind()) {
+                case Kind::Trig: {
+                    auto *tNum = static_cast<Trig *>(numerator);
+                    auto *tDen = static_cast<Trig *>(denominator);
                     if (tNum->getTrigType() == tDen->getTrigType()) {
                         if (Utilities::equalTrees(tNum->getNodeInput(), tDen->getNodeInput())) {
                             double numPower = tNum->getPower();
@@ -144,11 +146,11 @@ void Fraction::simplify() {
                             }
                         }
                     }
+                    break;
                 }
-            }
-
-            if (auto *lNum = dynamic_cast<Log *>(numerator)) {
-                if (auto *lDen = dynamic_cast<Log *>(denominator)) {
+                case Kind::Log: {
+                    auto *lNum = static_cast<Log *>(numerator);
+                    auto *lDen = static_cast<Log *>(denominator);
                     if (Utilities::equalTrees(lNum->getNodeInput(), lDen->getNodeInput())) {
                         double numPower = lNum->getPower();
                         double denPower = lDen->getPower();
@@ -164,11 +166,11 @@ void Fraction::simplify() {
                             denominator = new Constant(lDen->getCoef());
                         }
                     }
+                    break;
                 }
-            }
-
-            if (auto *pNum = dynamic_cast<Polynomial *>(numerator)) {
-                if (auto *pDen = dynamic_cast<Polynomial *>(denominator)) {
+                case Kind::Polynomial: {
+                    auto *pNum = static_cast<Polynomial *>(numerator);
+                    auto *pDen = static_cast<Polynomial *>(denominator);
                     int numPower = (int) pNum->getPower();
                     int denPower = (int) pDen->getPower();
                     int minPower = std::min(numPower, denPower);
@@ -182,7 +184,10 @@ void Fraction::simplify() {
                     if (pDen->getPower() == 0) {
                         denominator = new Constant(pDen->getCoeffArray()[0]);
                     }
+                    break;
                 }
+                default:
+                    break;
             }
         }
     }
@@ -198,8 +203,8 @@ int Fraction::commonMultiple() {
     Function *d = Fraction::to_fraction(denominator);
 
     // cast will always happen, no condition checks needed
-    auto f1 = dynamic_cast<Fraction *>(n);
-    auto f2 = dynamic_cast<Fraction *>(d);
+    auto f1 = static_cast<Fraction *>(n);
+    auto f2 = static_cast<Fraction *>(d);
 
     // divide the two fractions (cannot use operator division, infinite method calls)
     Function *num = *f1->numerator * *f2->denominator;
@@ -242,7 +247,8 @@ double Fraction::getValue() {
  * @return the fraction after addition
  */
 Function *Fraction::add(Function *f) {
-    if (auto *fraction = dynamic_cast<Fraction *>(f)) {
+    if (f->getKind() == Kind::Fraction) {
+        auto *fraction = static_cast<Fraction *>(f);
         // cross multiply and add the numerators
         Function *n1 = *numerator * *fraction->denominator;
         Function *n2 = *fraction->numerator * *denominator;
@@ -253,7 +259,7 @@ Function *Fraction::add(Function *f) {
         // create the fraction and simplify it
         Function *func = new Fraction(*n1 + *n2, d);
 
-        dynamic_cast<Fraction *>(func)->simplify();
+        static_cast<Fraction *>(func)->simplify();
 
         return func;
     } else {
@@ -270,7 +276,8 @@ Function *Fraction::add(Function *f) {
  * @return the fraction after subtraction
  */
 Function *Fraction::subtract(Function *f) {
-    if (auto *fraction = dynamic_cast<Fraction *>(f)) {
+    if (f->getKind() == Kind::Fraction) {
+        auto *fraction = static_cast<Fraction *>(f);
         // cross multiply and subtract the numerators
         Function *n1 = *numerator * *fraction->denominator;
         Function *n2 = *fraction->numerator * *denominator;
@@ -281,7 +288,7 @@ Function *Fraction::subtract(Function *f) {
         // create the fraction and simplify it
         Function *func = new Fraction(*n1 - *n2, d);
 
-        dynamic_cast<Fraction *>(func)->simplify();
+        static_cast<Fraction *>(func)->simplify();
 
         return func;
     } else {
@@ -297,7 +304,8 @@ Function *Fraction::subtract(Function *f) {
  * @return the fraction after multiplication
  */
 Function *Fraction::multiply(Function *f) {
-    if (auto *fraction = dynamic_cast<Fraction *>(f)) {
+    if (f->getKind() == Kind::Fraction) {
+        auto *fraction = static_cast<Fraction *>(f);
         // multiply numerators and denominators
         Function *n = *numerator * *fraction->numerator;
         Function *d = *denominator * *fraction->denominator;
@@ -305,7 +313,7 @@ Function *Fraction::multiply(Function *f) {
         // create the fraction and simplify it
         Function *func = new Fraction(n, d);
 
-        dynamic_cast<Fraction *>(func)->simplify();
+        static_cast<Fraction *>(func)->simplify();
 
         return func;
     } else {
@@ -324,7 +332,7 @@ Function *Fraction::multiply(Function *f) {
 Function *Fraction::pow(Function *f) {
     Function *c = new Constant(std::pow(getValue(), f->getValue()));
     Function *frac = Fraction::to_fraction(c);
-    dynamic_cast<Fraction *>(frac)->simplify();
+    static_cast<Fraction *>(frac)->simplify();
     return frac;
 }
 
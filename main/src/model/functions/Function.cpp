@@ -10,17 +10,41 @@
  */
 
 #include "../../../include/model/functions/Function.h"
+#include "../../../include/model/analyser/ParseSession.h"
 
 using namespace std;
 
-Function::Function() = default;
+/**
+ * parameterised constructor
+ * @param kind the concrete type of the function
+ */
+Function::Function(Kind kind) {
+    Function::kind = kind;
+}
+
+/**
+ * allocate a function from the open ParseSession, or the heap if there is none
+ * @param size the size of the function object
+ * @return the memory for the function
+ */
+void *Function::operator new(std::size_t size) {
+    return ParseSession::allocate(size, ParseSession::Kind::Function);
+}
+
+/**
+ * release a function, session memory is reclaimed when the session closes
+ * @param pointer the memory of the function
+ */
+void Function::operator delete(void *pointer) {
+    ParseSession::release(pointer);
+}
 
 /**
- * returns the type of equation
- * @return type The type of function
+ * returns the type of function, subclasses switch on it instead of casting
+ * @return kind the type of function
  */
-std::string Function::getType() {
-    return type;
+Function::Kind Function::getKind() const {
+    return kind;
 }
 
 /**
@@ -21,8 +21,7 @@
  * @param coef the coefficient of the logarithm
  * @param power the power of the logarithm
  */
-Log::Log(Node *input, double base, double coef, double power) {
-    Function::type = "Log";
+Log::Log(Node *input, double base, double coef, double power) : Function(Kind::Log) {
     Log::nodeInput = input;
     Log::base = base;
     Log::coef = coef;
@@ -40,8 +39,7 @@ Log::Log(Node *input, double base, double coef, double power) {
  * @param coef the coefficient of the logarithm
  * @param power the power of the logarithm
  */
-Log::Log(double input, double base, double coef, double power) {
-    Function::type = "Log";
+Log::Log(double input, double base, double coef, double power) : Function(Kind::Log) {
     Log::valueInput = input;
     Log::base = base;
     Log::coef = coef;
@@ -152,74 +150,84 @@ void Log::setPower(double power) {
  * @return a function after addition is done, nullptr if functions cannot be added
  */
 Function *Log::add(Function *f) {
-    // check if function is log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // check if inner functions are both constant
-        if (!nodeInput && !l->getNodeInput()) {
-            double val = getValue() + l->getValue();
-            Function *c = new Constant(val);
-            return c;
-        } else {
-            bool flag = true;
-
-            // if the base are not the same
-            if (getBase() != l->getBase()) {
-                flag = false;
-            }
+    switch (f->getKind()) {
+        // check if function is log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // check if inner functions are both constant
+            if (!nodeInput && !l->getNodeInput()) {
+                double val = getValue() + l->getValue();
+                Function *c = new Constant(val);
+                return c;
+            } else {
+                bool flag = true;
 
-            // if subtrees are not the same
-            if (!Utilities::equalTrees(getNodeInput(), l->getNodeInput())) {
-                flag = false;
-            }
+                // if the base are not the same
+                if (getBase() != l->getBase()) {
+                    flag = false;
+                }
 
-            // if exponents are not the same
-            if (getPower() != l->getPower()) {
-                flag = false;
-            }
+                // if subtrees are not the same
+                if (!Utilities::equalTrees(getNodeInput(), l->getNodeInput())) {
+                    flag = false;
+                }
 
-            // if condition passes, functions can be added
-            if (flag) {
-                Function *log = new Log(getNodeInput(), getBase(),
-                                        getCoef() + l->getCoef(), getPower());
-                return log;
-            } else {
-                return nullptr;
+                // if exponents are not the same
+                if (getPower() != l->getPower()) {
+                    flag = false;
+                }
+
+                // if condition passes, functions can be added
+                if (flag) {
+                    Function *log = new Log(getNodeInput(), getBase(),
+                                            getCoef() + l->getCoef(), getPower());
+                    return log;
+                } else {
+                    return nullptr;
+                }
             }
+            break;
         }
-    }
-
-    // check if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        if (!nodeInput) {
-            p->getCoeffArray()[0] += getValue();
-            return p;
+        // check if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            if (!nodeInput) {
+                p->getCoeffArray()[0] += getValue();
+                return p;
+            }
+            break;
         }
-    }
-
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-        if (!nodeInput && !t->getNodeInput()) {
-            double val = getValue() + t->getValue();
-            Function *c = new Constant(val);
-            return c;
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            if (!nodeInput && !t->getNodeInput()) {
+                double val = getValue() + t->getValue();
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        // ensure that input is a value input, not node input
-        if (!nodeInput) {
-            double newConst = getValue() + c->getValue();
-            Function *newF = new Constant(newConst);
-            return newF;
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            // ensure that input is a value input, not node input
+            if (!nodeInput) {
+                double newConst = getValue() + c->getValue();
+                Function *newF = new Constant(newConst);
+                return newF;
+            }
+            break;
         }
-    }
-
-    if (auto *frac = dynamic_cast<Fraction *>(f)) {
-        if (!nodeInput) {
-            Function *lToF = Fraction::to_fraction(this);
-            return *lToF + *frac;
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            if (!nodeInput) {
+                Function *lToF = Fraction::to_fraction(this);
+                return *lToF + *frac;
+            }
+            break;
         }
+        default:
+            break;
     }
 
     return nullptr;
@@ -232,79 +240,89 @@ Function *Log::add(Function *f) {
  * @return a function after subtraction is done, nullptr if functions cannot be subtracted
  */
 Function *Log::subtract(Function *f) {
-    // check if function is log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // check if inner functions are both constant
-        if (!nodeInput && !l->getNodeInput()) {
-            double val = getValue() - l->getValue();
-            Function *c = new Constant(val);
-            return c;
-        } else {
-            bool flag = true;
-
-            // if the base are not the same
-            if (getBase() != l->getBase()) {
-                flag = false;
-            }
+    switch (f->getKind()) {
+        // check if function is log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // check if inner functions are both constant
+            if (!nodeInput && !l->getNodeInput()) {
+                double val = getValue() - l->getValue();
+                Function *c = new Constant(val);
+                return c;
+            } else {
+                bool flag = true;
 
-            // if subtrees are not the same
-            if (!Utilities::equalTrees(getNodeInput(), l->getNodeInput())) {
-                flag = false;
-            }
+                // if the base are not the same
+                if (getBase() != l->getBase()) {
+                    flag = false;
+                }
 
-            // if exponents are not the same
-            if (getPower() != l->getPower()) {
-                flag = false;
-            }
+                // if subtrees are not the same
+                if (!Utilities::equalTrees(getNodeInput(), l->getNodeInput())) {
+                    flag = false;
+                }
 
-            // if condition passes, functions can be added
-            if (flag) {
-                if (getCoef() - l->getCoef() != 0) {
-                    Function *log = new Log(getNodeInput(), getBase(),
-                                            getCoef() - l->getCoef(), getPower());
-                    return log;
+                // if exponents are not the same
+                if (getPower() != l->getPower()) {
+                    flag = false;
+                }
+
+                // if condition passes, functions can be added
+                if (flag) {
+                    if (getCoef() - l->getCoef() != 0) {
+                        Function *log = new Log(getNodeInput(), getBase(),
+                                                getCoef() - l->getCoef(), getPower());
+                        return log;
+                    } else {
+                        Function *c = new Constant(0);
+                        return c;
+                    }
                 } else {
-                    Function *c = new Constant(0);
-                    return c;
+                    return nullptr;
                 }
-            } else {
-                return nullptr;
             }
+            break;
         }
-    }
-
-    // check if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        if (!nodeInput) {
-            p->getCoeffArray()[0] -= getValue();
-            return p;
+        // check if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            if (!nodeInput) {
+                p->getCoeffArray()[0] -= getValue();
+                return p;
+            }
+            break;
         }
-    }
-
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-        if (!nodeInput && !t->getNodeInput()) {
-            double val = getValue() - t->getValue();
-            Function *c = new Constant(val);
-            return c;
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            if (!nodeInput && !t->getNodeInput()) {
+                double val = getValue() - t->getValue();
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        // ensure that input is a value input, not node input
-        if (!nodeInput) {
-            double newConst = getValue() - c->getValue();
-            Function *newF = new Constant(newConst);
-            return newF;
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            // ensure that input is a value input, not node input
+            if (!nodeInput) {
+                double newConst = getValue() - c->getValue();
+                Function *newF = new Constant(newConst);
+                return newF;
+            }
+            break;
         }
-    }
-
-    if (auto *frac = dynamic_cast<Fraction *>(f)) {
-        if (!nodeInput) {
-            Function *lToF = Fraction::to_fraction(this);
-            return *lToF - *frac;
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            if (!nodeInput) {
+                Function *lToF = Fraction::to_fraction(this);
+                return *lToF - *frac;
+            }
+            break;
         }
+        default:
+            break;
     }
 
     return nullptr;
@@ -317,72 +335,82 @@ Function *Log::subtract(Function *f) {
  * @return a function after multiplication is done, nullptr if functions cannot be multiplied
  */
 Function *Log::multiply(Function *f) {
-    // check if function is log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // check if inner functions are both constant
-        if (!nodeInput && !l->getNodeInput()) {
-            double val = getValue() * l->getValue();
-            Function *c = new Constant(val);
-            return c;
-        } else {
-            bool flag = true;
-
-            // if the base are not the same
-            if (getBase() != l->getBase()) {
-                flag = false;
-            }
+    switch (f->getKind()) {
+        // check if function is log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // check if inner functions are both constant
+            if (!nodeInput && !l->getNodeInput()) {
+                double val = getValue() * l->getValue();
+                Function *c = new Constant(val);
+                return c;
+            } else {
+                bool flag = true;
 
-            // if subtrees are not the same
-            if (!Utilities::equalTrees(getNodeInput(), l->getNodeInput())) {
-                flag = false;
-            }
+                // if the base are not the same
+                if (getBase() != l->getBase()) {
+                    flag = false;
+                }
 
-            // if condition passes, functions can be added
-            if (flag) {
-                Function *log = new Log(getNodeInput(), getBase(),
-                                        getCoef() * l->getCoef(),
-                                        getPower() + l->getPower());
-                return log;
-            } else {
-                return nullptr;
+                // if subtrees are not the same
+                if (!Utilities::equalTrees(getNodeInput(), l->getNodeInput())) {
+                    flag = false;
+                }
+
+                // if condition passes, functions can be added
+                if (flag) {
+                    Function *log = new Log(getNodeInput(), getBase(),
+                                            getCoef() * l->getCoef(),
+                                            getPower() + l->getPower());
+                    return log;
+                } else {
+                    return nullptr;
+                }
             }
+            break;
         }
-    }
-
-    // check if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        if (!nodeInput) {
-            return p->scalarMultiply(getValue());
+        // check if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            if (!nodeInput) {
+                return p->scalarMultiply(getValue());
+            }
+            break;
         }
-    }
-
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-        if (!nodeInput && !t->getNodeInput()) {
-            double val = getValue() * t->getValue();
-            Function *c = new Constant(val);
-            return c;
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            if (!nodeInput && !t->getNodeInput()) {
+                double val = getValue() * t->getValue();
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        if (!nodeInput) {
-            Function *func = new Constant(getValue() * c->getValue());
-            return func;
-        } else {
-            Function *log = new Log(getNodeInput(), getBase(),
-                                    getCoef() * c->getValue(), getPower());
-            return log;
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            if (!nodeInput) {
+                Function *func = new Constant(getValue() * c->getValue());
+                return func;
+            } else {
+                Function *log = new Log(getNodeInput(), getBase(),
+                                        getCoef() * c->getValue(), getPower());
+                return log;
+            }
+            break;
         }
-    }
-
-    // check if function is a fraction
-    if (auto *frac = dynamic_cast<Fraction *>(f)) {
-        if (!nodeInput) {
-            Function *lToF = Fraction::to_fraction(this);
-            return *lToF * *frac;
+        // check if function is a fraction
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            if (!nodeInput) {
+                Function *lToF = Fraction::to_fraction(this);
+                return *lToF * *frac;
+            }
+            break;
         }
+        default:
+            break;
     }
 
     return nullptr;
@@ -395,43 +423,52 @@ Function *Log::multiply(Function *f) {
  * @return a function after power is done, nullptr if functions cannot be powered
  */
 Function *Log::pow(Function *f) {
-    // check if function is log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // check if inner functions are both constant
-        if (!nodeInput && !l->getNodeInput()) {
-            double val = std::pow(getValue(), l->getValue());
-            Function *c = new Constant(val);
-            return c;
+    switch (f->getKind()) {
+        // check if function is log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // check if inner functions are both constant
+            if (!nodeInput && !l->getNodeInput()) {
+                double val = std::pow(getValue(), l->getValue());
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-        if (!nodeInput && !t->getNodeInput()) {
-            double val = std::pow(getValue(), t->getValue());
-            Function *c = new Constant(val);
-            return c;
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            if (!nodeInput && !t->getNodeInput()) {
+                double val = std::pow(getValue(), t->getValue());
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        // ensure that input is a value input, not node input
-        if (!nodeInput) {
-            double newConst = std::pow(getValue(), c->getValue());
-            Function *newF = new Constant(newConst);
-            return newF;
-        } else {
-            setPower(getPower() * c->getValue());
-            return this;
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            // ensure that input is a value input, not node input
+            if (!nodeInput) {
+                double newConst = std::pow(getValue(), c->getValue());
+                Function *newF = new Constant(newConst);
+                return newF;
+            } else {
+                setPower(getPower() * c->getValue());
+                return this;
+            }
+            break;
         }
-    }
-
-    if (auto *frac = dynamic_cast<Fraction *>(f)) {
-        if (!nodeInput) {
-            Function *c = new Constant(std::pow(getValue(), frac->getValue()));
-            return c;
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            if (!nodeInput) {
+                Function *c = new Constant(std::pow(getValue(), frac->getValue()));
+                return c;
+            }
+            break;
         }
+        default:
+            break;
     }
 
     return nullptr;
@@ -455,7 +492,7 @@ std::string Log::toString() {
         if (nodeInput->getLeft()) {
             result += nodeInput->getLeft()->toString();
         }
-        result += Utilities::removeTrailingZeros(nodeInput->getValue()->value);
+        result += Utilities::removeTrailingZeros(nodeInput->getValue()->getText());
         if (nodeInput->getRight()) {
             result += nodeInput->getRight()->toString();
         }
@@ -17,16 +17,17 @@
 #include "../../../include/model/functions/Constant.h"
 #include "../../../include/model/functions/Trig.h"
 #include "../../../include/model/functions/Log.h"
+#include "../../../include/model/analyser/SymbolTable.h"
 
 
 /**
  * parameterised constructor
  * @param arr the array that representing coefficients
  * @param size the size of the array
+ * @param variable the id of the variable in the SymbolTable
  */
-Polynomial::Polynomial(const double arr[], int size, char variable) {
+Polynomial::Polynomial(const double arr[], int size, int variable) : Function(Kind::Polynomial) {
 //    Polynomial::coeff[size];
-    Function::type = "Polynomial";
     Polynomial::variable = variable;
 
     // copy the array to coeff vector
@@ -43,11 +44,10 @@ Polynomial::Polynomial(const double arr[], int size, char variable) {
 /**
  * parameterised constructor for single polynomial
  * @param coefficient the coefficient of polynomial
- * @param variable the variable of polynomial
+ * @param variable the id of the variable of polynomial in the SymbolTable
  * @param degree the degree of polynomial
  */
-Polynomial::Polynomial(double coefficient, char variable, int degree) {
-    Function::type = "Polynomial";
+Polynomial::Polynomial(double coefficient, int variable, int degree) : Function(Kind::Polynomial) {
     Polynomial::degree = degree;
     Polynomial::variable = variable;
 
@@ -65,9 +65,9 @@ Polynomial::Polynomial(double coefficient, char variable, int degree) {
 
 /**
  * getter method for polynomial variable
- * @return the variable
+ * @return the id of the variable in the SymbolTable
  */
-char Polynomial::getVariable() const {
+int Polynomial::getVariable() const {
     return variable;
 }
 
@@ -131,59 +131,66 @@ void Polynomial::shiftPower(int shiftAmount) {
  * @return the polynomial after addition
  */
 Function *Polynomial::add(Function *f) {
-    // check if function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        // check if both polynomials have the same variable
-        if (variable != p->variable) {
-            return nullptr;
-        }
-
-        // get the higher degree between the two polynomials
-        int n = std::max(degree, p->degree);
+    switch (f->getKind()) {
+        // check if function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            // check if both polynomials have the same variable
+            if (variable != p->variable) {
+                return nullptr;
+            }
 
-        std::vector<double> arr(n + 1);
+            // get the higher degree between the two polynomials
+            int n = std::max(degree, p->degree);
 
-        // add the coefficients of this polynomial
-        for (int i = 0; i <= degree; i++) {
-            arr.at(i) += coeff.at(i);
-        }
+            std::vector<double> arr(n + 1);
 
-        // add the coefficients of p polynomial
-        for (int i = 0; i <= p->degree; i++) {
-            arr.at(i) += p->coeff.at(i);
-        }
+            // add the coefficients of this polynomial
+            for (int i = 0; i <= degree; i++) {
+                arr.at(i) += coeff.at(i);
+            }
 
-        // create the object and reduce it
-        Function *ans = new Polynomial(arr.data(), n + 1, variable);
-//        ans.reduce();
-        return ans;
-    }
+            // add the coefficients of p polynomial
+            for (int i = 0; i <= p->degree; i++) {
+                arr.at(i) += p->coeff.at(i);
+            }
 
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-        // if trig has constant inner function
-        if (!t->getNodeInput()) {
-            this->coeff[0] += t->getValue();
-            this->reduce();
-            return this;
+            // create the object and reduce it
+            Function *ans = new Polynomial(arr.data(), n + 1, variable);
+    //        ans.reduce();
+            return ans;
         }
-    }
-
-    // check if function is a log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // if log has constant inner function
-        if (!l->getNodeInput()) {
-            this->coeff[0] += l->getValue();
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            // if trig has constant inner function
+            if (!t->getNodeInput()) {
+                this->coeff[0] += t->getValue();
+                this->reduce();
+                return this;
+            }
+            break;
+        }
+        // check if function is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // if log has constant inner function
+            if (!l->getNodeInput()) {
+                this->coeff[0] += l->getValue();
+                this->reduce();
+                return this;
+            }
+            break;
+        }
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            this->coeff[0] += c->getValue();
             this->reduce();
             return this;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        this->coeff[0] += c->getValue();
-        this->reduce();
-        return this;
+        default:
+            break;
     }
 
     return nullptr;
@@ -195,58 +202,65 @@ Function *Polynomial::add(Function *f) {
  * @return the polynomial after subtraction
  */
 Function *Polynomial::subtract(Function *f) {
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        // check if both polynomials have the same variable
-        if (variable != p->variable) {
-            return nullptr;
-        }
-
-        // get the max degree
-        int n = std::max(degree, p->degree);
+    switch (f->getKind()) {
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            // check if both polynomials have the same variable
+            if (variable != p->variable) {
+                return nullptr;
+            }
 
-        std::vector<double> arr(n + 1);
+            // get the max degree
+            int n = std::max(degree, p->degree);
 
-        // add this polynomial
-        for (int i = 0; i <= degree; i++) {
-            arr.at(i) += coeff.at(i);
-        }
+            std::vector<double> arr(n + 1);
 
-        // subtract polynomial p from "this" polynomial
-        for (int i = 0; i <= p->degree; i++) {
-            arr.at(i) -= p->coeff.at(i);
-        }
+            // add this polynomial
+            for (int i = 0; i <= degree; i++) {
+                arr.at(i) += coeff.at(i);
+            }
 
-        // create the object and reduce it
-        Function *ans = new Polynomial(arr.data(), n + 1, variable);
-//        ans.reduce();
-        return ans;
-    }
+            // subtract polynomial p from "this" polynomial
+            for (int i = 0; i <= p->degree; i++) {
+                arr.at(i) -= p->coeff.at(i);
+            }
 
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-        // if trig has constant inner function
-        if (!t->getNodeInput()) {
-            this->coeff[0] -= t->getValue();
-            this->reduce();
-            return this;
+            // create the object and reduce it
+            Function *ans = new Polynomial(arr.data(), n + 1, variable);
+    //        ans.reduce();
+            return ans;
         }
-    }
-
-    // check if function is a log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // if log has constant inner function
-        if (!l->getNodeInput()) {
-            this->coeff[0] -= l->getValue();
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            // if trig has constant inner function
+            if (!t->getNodeInput()) {
+                this->coeff[0] -= t->getValue();
+                this->reduce();
+                return this;
+            }
+            break;
+        }
+        // check if function is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // if log has constant inner function
+            if (!l->getNodeInput()) {
+                this->coeff[0] -= l->getValue();
+                this->reduce();
+                return this;
+            }
+            break;
+        }
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            this->coeff[0] -= c->getValue();
             this->reduce();
             return this;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        this->coeff[0] -= c->getValue();
-        this->reduce();
-        return this;
+        default:
+            break;
     }
 
     return nullptr;
@@ -259,52 +273,59 @@ Function *Polynomial::subtract(Function *f) {
  * @return the polynomial after multiplication
  */
 Function *Polynomial::multiply(Function *f) {
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        // check if both polynomials have the same variable
-        if (variable != p->variable) {
-            return nullptr;
-        }
+    switch (f->getKind()) {
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            // check if both polynomials have the same variable
+            if (variable != p->variable) {
+                return nullptr;
+            }
 
-        // add two degrees, this is the new degree of polynomial
-        int n = degree + p->degree;
+            // add two degrees, this is the new degree of polynomial
+            int n = degree + p->degree;
 
-        std::vector<double> arr(n + 1);
+            std::vector<double> arr(n + 1);
 
-        // multiply both coefficients of polynomials
-        for (int i = 0; i < coeff.size(); i++) {
-            for (int j = 0; j < p->coeff.size(); j++) {
-                arr.at(i + j) += coeff.at(i) * p->coeff.at(j);
+            // multiply both coefficients of polynomials
+            for (int i = 0; i < coeff.size(); i++) {
+                for (int j = 0; j < p->coeff.size(); j++) {
+                    arr.at(i + j) += coeff.at(i) * p->coeff.at(j);
+                }
             }
-        }
 
-        // create the object and reduce it
-        Function *ans = new Polynomial(arr.data(), n + 1, variable);
-//        ans.reduce();
-        return ans;
-    }
-
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-        // if trig has constant inner function
-        if (!t->getNodeInput()) {
-            this->scalarMultiply(t->getValue());
-            return this;
+            // create the object and reduce it
+            Function *ans = new Polynomial(arr.data(), n + 1, variable);
+    //        ans.reduce();
+            return ans;
         }
-    }
-
-    // check if function is a log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // if log has constant inner function
-        if (!l->getNodeInput()) {
-            this->scalarMultiply(l->getValue());
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            // if trig has constant inner function
+            if (!t->getNodeInput()) {
+                this->scalarMultiply(t->getValue());
+                return this;
+            }
+            break;
+        }
+        // check if function is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // if log has constant inner function
+            if (!l->getNodeInput()) {
+                this->scalarMultiply(l->getValue());
+                return this;
+            }
+            break;
+        }
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            this->scalarMultiply(c->getValue());
             return this;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        this->scalarMultiply(c->getValue());
-        return this;
+        default:
+            break;
     }
 
     return nullptr;
@@ -312,44 +333,50 @@ Function *Polynomial::multiply(Function *f) {
 
 
 Function *Polynomial::pow(Function *f) {
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        return nullptr;
-    }
-
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-        // if trig has constant inner function
-        if (!t->getNodeInput()) {
-            Function *p = this;
-            int val = (int) t->getValue();
-            for (int i = 0; i < val; i++) {
-                p = p->multiply(p);
+    switch (f->getKind()) {
+        // a polynomial exponent cannot be reduced
+        case Kind::Polynomial:
+            return nullptr;
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+            // if trig has constant inner function
+            if (!t->getNodeInput()) {
+                Function *p = this;
+                int val = (int) t->getValue();
+                for (int i = 0; i < val; i++) {
+                    p = p->multiply(p);
+                }
+                return p;
             }
-            return p;
+            break;
         }
-    }
-
-    // check if function is a log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // if log has constant inner function
-        if (!l->getNodeInput()) {
+        // check if function is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // if log has constant inner function
+            if (!l->getNodeInput()) {
+                Function *p = this;
+                int val = (int) l->getValue();
+                for (int i = 0; i < val; i++) {
+                    p = p->multiply(p);
+                }
+                return p;
+            }
+            break;
+        }
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
             Function *p = this;
-            int val = (int) l->getValue();
+            int val = (int) c->getValue();
             for (int i = 0; i < val; i++) {
                 p = p->multiply(p);
             }
             return p;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        Function *p = this;
-        int val = (int) c->getValue();
-        for (int i = 0; i < val; i++) {
-            p = p->multiply(p);
-        }
-        return p;
+        default:
+            break;
     }
 
     return nullptr;
@@ -404,19 +431,20 @@ std::string Polynomial::toString() {
         return Utilities::removeTrailingZeros(coeff.at(0));
     }
     std::string result;
+    const std::string &name = SymbolTable::name(variable);
 
     // loop backwards, the highest degree is printed first
     for (int i = coeff.size() - 1; i > 0; i--) {
         if (coeff.at(i) != 0) {
             if (coeff.at(i) == 1) {
-                result += variable;
+                result += name;
             } else if (coeff.at(i) == -1) {
                 result += "-";
-                result += variable;
+                result += name;
             } else {
                 // convert the double to string
                 std::string s = Utilities::removeTrailingZeros(coeff.at(i));
-                result += s + variable;
+                result += s + name;
             }
 
             if (i != 1) {
@@ -25,8 +25,7 @@
  * @param coef the coefficient of the trig
  * @param power the power of the trig
  */
-Trig::Trig(Node *nodeInput, std::string trigType, double coef = 1, double power = 1) {
-    Function::type = "Trig";
+Trig::Trig(Node *nodeInput, std::string trigType, double coef = 1, double power = 1) : Function(Kind::Trig) {
     Trig::trigType = trigType;
     Trig::nodeInput = nodeInput;
     Trig::coef = coef;
@@ -41,8 +40,7 @@ Trig::Trig(Node *nodeInput, std::string trigType, double coef = 1, double power
  * @param coef the coefficient of the trig
  * @param power the power of the trig
  */
-Trig::Trig(double valueInput, std::string trigType, double coef = 1, double power = 1) {
-    Function::type = "Trig";
+Trig::Trig(double valueInput, std::string trigType, double coef = 1, double power = 1) : Function(Kind::Trig) {
     Trig::trigType = trigType;
     Trig::valueInput = valueInput * PI / 180;
     Trig::coef = coef;
@@ -158,80 +156,90 @@ double Trig::getValue() {
  * @return a function after addition is done, nullptr if functions cannot be added
  */
 Function *Trig::add(Function *f) {
-    // check if function is a trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-
-        // check if the inner function is a constant
-        // inner function is always the most reduced form
-        //if (get)
-
-        if (!nodeInput && !t->nodeInput) {
-            double combined = getValue() + f->getValue();
-            Function *c = new Constant(combined);
-            return c;
-        } else {
-            bool flag = true;
-            // both trig types must be same to perform any operations
-            if (getTrigType() != t->getTrigType()) {
-                flag = false;
-            }
+    switch (f->getKind()) {
+        // check if function is a trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+
+            // check if the inner function is a constant
+            // inner function is always the most reduced form
+            //if (get)
+
+            if (!nodeInput && !t->nodeInput) {
+                double combined = getValue() + f->getValue();
+                Function *c = new Constant(combined);
+                return c;
+            } else {
+                bool flag = true;
+                // both trig types must be same to perform any operations
+                if (getTrigType() != t->getTrigType()) {
+                    flag = false;
+                }
 
-            // if subtrees are not the same
-            if (!Utilities::equalTrees(getNodeInput(), t->getNodeInput())) {
-                flag = false;
-            }
+                // if subtrees are not the same
+                if (!Utilities::equalTrees(getNodeInput(), t->getNodeInput())) {
+                    flag = false;
+                }
 
-            // if exponents are not the same
-            if (power != t->getPower()) {
-                flag = false;
-            }
+                // if exponents are not the same
+                if (power != t->getPower()) {
+                    flag = false;
+                }
 
-            if (flag) {
-                // Can Combine
-                Function *trig = new Trig(getNodeInput(), getTrigType(),
-                                          this->getCoef() + t->getCoef(), getPower());
-                return trig;
-            } else {
-                // Can't combine
-                return nullptr;
+                if (flag) {
+                    // Can Combine
+                    Function *trig = new Trig(getNodeInput(), getTrigType(),
+                                              this->getCoef() + t->getCoef(), getPower());
+                    return trig;
+                } else {
+                    // Can't combine
+                    return nullptr;
+                }
             }
+            break;
         }
-    }
-
-    // check if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        if (!nodeInput) {
-            p->getCoeffArray()[0] += getValue();
-            return p;
+        // check if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            if (!nodeInput) {
+                p->getCoeffArray()[0] += getValue();
+                return p;
+            }
+            break;
         }
-    }
-
-    // check if the functions is a log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // check if both functions have constant inner functions
-        if (!nodeInput && !l->getNodeInput()) {
-            double val = getValue() + l->getValue();
-            Function *c = new Constant(val);
-            return c;
+        // check if the functions is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // check if both functions have constant inner functions
+            if (!nodeInput && !l->getNodeInput()) {
+                double val = getValue() + l->getValue();
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        // ensure that input is a value input, not node input
-        if (!nodeInput) {
-            double newConst = getValue() + c->getValue();
-            Function *newF = new Constant(newConst);
-            return newF;
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            // ensure that input is a value input, not node input
+            if (!nodeInput) {
+                double newConst = getValue() + c->getValue();
+                Function *newF = new Constant(newConst);
+                return newF;
+            }
+            break;
         }
-    }
-
-    // if the function is a fraction
-    if (auto *frac = dynamic_cast<Fraction *>(f)) {
-        if (!nodeInput) {
-            Function *tToF = Fraction::to_fraction(this);
-            return *tToF + *frac;
+        // if the function is a fraction
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            if (!nodeInput) {
+                Function *tToF = Fraction::to_fraction(this);
+                return *tToF + *frac;
+            }
+            break;
         }
+        default:
+            break;
     }
 
     return nullptr;
@@ -244,82 +252,92 @@ Function *Trig::add(Function *f) {
  * @return a function after subtraction is done, nullptr if functions cannot be subtracted
  */
 Function *Trig::subtract(Function *f) {
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-
-        // check if the inner function is a constant
-        // inner function is always the most reduced form
-
-        if (!nodeInput && !t->nodeInput) {
-            double combined = getValue() - f->getValue();
-            Function *c = new Constant(combined);
-            return c;
-        } else {
-            bool flag = true;
-            // both trig types must be same to perform any operations
-            if (getTrigType() != t->getTrigType()) {
-                flag = false;
-            }
+    switch (f->getKind()) {
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
 
-            // if subtrees are not the same
-            if (!Utilities::equalTrees(getNodeInput(), t->getNodeInput())) {
-                flag = false;
-            }
+            // check if the inner function is a constant
+            // inner function is always the most reduced form
 
-            // if exponents are not the same
-            if (power != t->getPower()) {
-                flag = false;
-            }
+            if (!nodeInput && !t->nodeInput) {
+                double combined = getValue() - f->getValue();
+                Function *c = new Constant(combined);
+                return c;
+            } else {
+                bool flag = true;
+                // both trig types must be same to perform any operations
+                if (getTrigType() != t->getTrigType()) {
+                    flag = false;
+                }
 
-            if (flag) {
-                // Can Combine
-                if (this->getCoef() - t->getCoef() != 0) {
-                    Function *trig = new Trig(getNodeInput(), getTrigType(),
-                                              this->getCoef() - t->getCoef(), getPower());
-                    return trig;
+                // if subtrees are not the same
+                if (!Utilities::equalTrees(getNodeInput(), t->getNodeInput())) {
+                    flag = false;
+                }
+
+                // if exponents are not the same
+                if (power != t->getPower()) {
+                    flag = false;
+                }
+
+                if (flag) {
+                    // Can Combine
+                    if (this->getCoef() - t->getCoef() != 0) {
+                        Function *trig = new Trig(getNodeInput(), getTrigType(),
+                                                  this->getCoef() - t->getCoef(), getPower());
+                        return trig;
+                    } else {
+                        Function *c = new Constant(0);
+                        return c;
+                    }
                 } else {
-                    Function *c = new Constant(0);
-                    return c;
+                    // Can't combine
+                    return nullptr;
                 }
-            } else {
-                // Can't combine
-                return nullptr;
             }
+            break;
         }
-    }
-
-    // check if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        if (!nodeInput) {
-            p->getCoeffArray()[0] -= getValue();
-            return p;
+        // check if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            if (!nodeInput) {
+                p->getCoeffArray()[0] -= getValue();
+                return p;
+            }
+            break;
         }
-    }
-
-    // check if the functions is a log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // check if both functions have constant inner functions
-        if (!nodeInput && !l->getNodeInput()) {
-            double val = getValue() - l->getValue();
-            Function *c = new Constant(val);
-            return c;
+        // check if the functions is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // check if both functions have constant inner functions
+            if (!nodeInput && !l->getNodeInput()) {
+                double val = getValue() - l->getValue();
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        if (!nodeInput) {
-            double newConst = getValue() - c->getValue();
-            Function *newF = new Constant(newConst);
-            return newF;
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            if (!nodeInput) {
+                double newConst = getValue() - c->getValue();
+                Function *newF = new Constant(newConst);
+                return newF;
+            }
+            break;
         }
-    }
-
-    // if the function is a fraction
-    if (auto *frac = dynamic_cast<Fraction *>(f)) {
-        if (!nodeInput) {
-            Function *tToF = Fraction::to_fraction(this);
-            return *tToF - *frac;
+        // if the function is a fraction
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            if (!nodeInput) {
+                Function *tToF = Fraction::to_fraction(this);
+                return *tToF - *frac;
+            }
+            break;
         }
+        default:
+            break;
     }
 
     return nullptr;
@@ -332,74 +350,84 @@ Function *Trig::subtract(Function *f) {
  * @return a function after multiplication is done, nullptr if functions cannot be multiplied
  */
 Function *Trig::multiply(Function *f) {
-    // if cast is valid, then both functions are trig
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-
-        // check if the inner function is a constant
-        // inner function is always the most reduced form
-        if (t && !nodeInput && !t->nodeInput) {
-            double combined = getValue() * f->getValue();
-            Function *c = new Constant(combined);
-            return c;
-        } else {
-            bool flag = true;
-            // both trig types must be same to perform any operations
-            if (getTrigType() != t->getTrigType()) {
-                flag = false;
-            }
+    switch (f->getKind()) {
+        // if cast is valid, then both functions are trig
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+
+            // check if the inner function is a constant
+            // inner function is always the most reduced form
+            if (t && !nodeInput && !t->nodeInput) {
+                double combined = getValue() * f->getValue();
+                Function *c = new Constant(combined);
+                return c;
+            } else {
+                bool flag = true;
+                // both trig types must be same to perform any operations
+                if (getTrigType() != t->getTrigType()) {
+                    flag = false;
+                }
 
-            // if subtrees are not the same
-            if (!Utilities::equalTrees(getNodeInput(), t->getNodeInput())) {
-                flag = false;
-            }
+                // if subtrees are not the same
+                if (!Utilities::equalTrees(getNodeInput(), t->getNodeInput())) {
+                    flag = false;
+                }
 
-            if (flag) {
-                // Can Combine
-                Function *trig = new Trig(getNodeInput(), getTrigType(),
-                                          getCoef() * t->getCoef(), getPower() + t->getPower());
-                return trig;
-            } else {
-                // Can't combine
-                return nullptr;
+                if (flag) {
+                    // Can Combine
+                    Function *trig = new Trig(getNodeInput(), getTrigType(),
+                                              getCoef() * t->getCoef(), getPower() + t->getPower());
+                    return trig;
+                } else {
+                    // Can't combine
+                    return nullptr;
+                }
             }
+            break;
         }
-    }
-
-    // check if the function is a polynomial
-    if (auto *p = dynamic_cast<Polynomial *>(f)) {
-        if (!nodeInput) {
-            return p->scalarMultiply(getValue());
+        // check if the function is a polynomial
+        case Kind::Polynomial: {
+            auto *p = static_cast<Polynomial *>(f);
+            if (!nodeInput) {
+                return p->scalarMultiply(getValue());
+            }
+            break;
         }
-    }
-
-    // check if the functions is a log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // check if both functions have constant inner functions
-        if (!nodeInput && !l->getNodeInput()) {
-            double val = getValue() * l->getValue();
-            Function *c = new Constant(val);
-            return c;
+        // check if the functions is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // check if both functions have constant inner functions
+            if (!nodeInput && !l->getNodeInput()) {
+                double val = getValue() * l->getValue();
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        if (!nodeInput) {
-            Function *func = new Constant(getValue() * c->getValue());
-            return func;
-        } else {
-            Function *trig = new Trig(getNodeInput(), getTrigType(),
-                                      getCoef() * c->getValue(), getPower());
-            return trig;
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            if (!nodeInput) {
+                Function *func = new Constant(getValue() * c->getValue());
+                return func;
+            } else {
+                Function *trig = new Trig(getNodeInput(), getTrigType(),
+                                          getCoef() * c->getValue(), getPower());
+                return trig;
+            }
+            break;
         }
-    }
-
-    // if the function is a fraction
-    if (auto *frac = dynamic_cast<Fraction *>(f)) {
-        if (!nodeInput) {
-            Function *tToF = Fraction::to_fraction(this);
-            return *tToF * *frac;
+        // if the function is a fraction
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            if (!nodeInput) {
+                Function *tToF = Fraction::to_fraction(this);
+                return *tToF * *frac;
+            }
+            break;
         }
+        default:
+            break;
     }
 
     return nullptr;
@@ -412,45 +440,53 @@ Function *Trig::multiply(Function *f) {
  * @return a function after power is done, nullptr if functions cannot be powered
  */
 Function *Trig::pow(Function *f) {
-    if (auto *t = dynamic_cast<Trig *>(f)) {
-
-        // check if the inner function is a constant
-        // inner function is always the most reduced form
-        if (!nodeInput && !t->nodeInput) {
-            double combined = std::pow(getValue(), f->getValue());
-            Function *c = new Constant(combined);
-            return c;
+    switch (f->getKind()) {
+        case Kind::Trig: {
+            auto *t = static_cast<Trig *>(f);
+
+            // check if the inner function is a constant
+            // inner function is always the most reduced form
+            if (!nodeInput && !t->nodeInput) {
+                double combined = std::pow(getValue(), f->getValue());
+                Function *c = new Constant(combined);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if the functions is a log
-    if (auto *l = dynamic_cast<Log *>(f)) {
-        // check if both functions have constant inner functions
-        if (!nodeInput && !l->getNodeInput()) {
-            double val = std::pow(getValue(), l->getValue());
-            Function *c = new Constant(val);
-            return c;
+        // check if the functions is a log
+        case Kind::Log: {
+            auto *l = static_cast<Log *>(f);
+            // check if both functions have constant inner functions
+            if (!nodeInput && !l->getNodeInput()) {
+                double val = std::pow(getValue(), l->getValue());
+                Function *c = new Constant(val);
+                return c;
+            }
+            break;
         }
-    }
-
-    // check if function is a constant
-    if (auto *c = dynamic_cast<Constant *>(f)) {
-        if (!nodeInput) {
-            double newConst = std::pow(getValue(), c->getValue());
-            Function *newF = new Constant(newConst);
-            return newF;
-        } else {
-            setPower(getPower() * c->getValue());
-            return this;
+        // check if function is a constant
+        case Kind::Constant: {
+            auto *c = static_cast<Constant *>(f);
+            if (!nodeInput) {
+                double newConst = std::pow(getValue(), c->getValue());
+                Function *newF = new Constant(newConst);
+                return newF;
+            } else {
+                setPower(getPower() * c->getValue());
+                return this;
+            }
+            break;
         }
-    }
-
-
-    if (auto *frac = dynamic_cast<Fraction *>(f)) {
-        if (!nodeInput) {
-            Function *c = new Constant(std::pow(getValue(), frac->getValue()));
-            return c;
+        case Kind::Fraction: {
+            auto *frac = static_cast<Fraction *>(f);
+            if (!nodeInput) {
+                Function *c = new Constant(std::pow(getValue(), frac->getValue()));
+                return c;
+            }
+            break;
         }
+        default:
+            break;
     }
 
     return nullptr;
@@ -474,7 +510,7 @@ std::string Trig::toString() {
         if (nodeInput->getLeft()) {
             result += nodeInput->getLeft()->toString();
         }
-        result += Utilities::removeTrailingZeros(nodeInput->getValue()->value);
+        result += Utilities::removeTrailingZeros(nodeInput->getValue()->getText());
         if (nodeInput->getRight()) {
             result += nodeInput->getRight()->toString();
         }
@@ -0,0 +1,93 @@
+/**
+ * @brief This class reduces a matrix to RREF without rounding
+ *
+ * @details Values that do not fit in 64 bits throw std::runtime_error, so a
+ * caller can fall back to Matrix::reduceToRREF.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "../../../include/model/matrices/ExactMatrix.h"
+
+/**
+ * @brief copy a matrix, scaling each row by the smallest number that makes it whole
+ * @details scaling a row of an augmented matrix does not change the solutions
+ * @param matrix the values to copy
+ */
+ExactMatrix::ExactMatrix(const Matrix &matrix) : rows(matrix.getRows()), cols(matrix.getCols()),
+                                                 values((size_t) rows * cols) {
+    std::vector<Rational> row(cols);
+    for (int i = 0; i < rows; i++) {
+        long long multiple = 1;
+        for (int j = 0; j < cols; j++) {
+            row[j] = Rational::fromDouble(matrix(i, j));
+            long long denominator = row[j].getDenominator();
+            multiple = Rational::multiply(multiple / Rational::gcd(multiple, denominator), denominator);
+        }
+        for (int j = 0; j < cols; j++)
+            value(i, j) = Rational::multiply(row[j].getNumerator(), multiple / row[j].getDenominator());
+    }
+}
+
+/**
+ * @brief reduces the matrix to row-reduced echelon form with fraction-free elimination
+ */
+void ExactMatrix::reduceToRREF() {
+    long long previous = 1;
+    int pivot_row = 0;
+    for (int col = 0; col < cols && pivot_row < rows; col++) {
+        int found = pivot_row;
+        while (found < rows && value(found, col) == 0)
+            found++;
+        if (found == rows)
+            continue;
+        if (found != pivot_row) {
+            std::swap_ranges(values.begin() + (size_t) found * cols, values.begin() + (size_t) (found + 1) * cols,
+                             values.begin() + (size_t) pivot_row * cols);
+        }
+
+        long long pivot = value(pivot_row, col);
+        for (int i = 0; i < rows; i++) {
+            if (i == pivot_row)
+                continue;
+            long long factor = value(i, col);
+            for (int j = 0; j < cols; j++) {
+                if (j == col)
+                    continue;
+                long long numerator = Rational::subtract(Rational::multiply(pivot, value(i, j)),
+                                                         Rational::multiply(factor, value(pivot_row, j)));
+                value(i, j) = numerator / previous;
+            }
+            value(i, col) = 0;
+        }
+        previous = pivot;
+        pivot_row++;
+    }
+    divisor = previous;
+}
+
+/**
+ * @brief get a value of the matrix
+ * @param row the row of the value
+ * @param col the column of the value
+ * @return the exact value, in lowest terms
+ */
+Rational ExactMatrix::at(int row, int col) const {
+    return Rational(values[(size_t) row * cols + col], divisor);
+}
+
+int ExactMatrix::getRows() const {
+    return rows;
+}
+
+int ExactMatrix::getCols() const {
+    return cols;
+}
+
+long long &ExactMatrix::value(int row, int col) {
+    return values[(size_t) row * cols + col];
+}
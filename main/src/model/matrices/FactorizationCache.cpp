@@ -0,0 +1,162 @@
+/**
+ * @brief This class keeps the factors of recently solved coefficient matrices
+ *
+ * @details See FactorizationCache.h. Factoring happens outside the lock, so
+ * two threads asking for the same new matrix may both factor it; only the
+ * first result is kept.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <cstring>
+
+#include "../../../include/model/matrices/FactorizationCache.h"
+
+/**
+ * @brief create an empty cache
+ * @param maxValues the number of doubles the entries may hold together, a
+ * matrix too large to fit is factored but not kept
+ * @param hasher the hash that entries are found by
+ */
+FactorizationCache::FactorizationCache(std::size_t maxValues, Hasher hasher) : maxValues(maxValues), hasher(hasher) {}
+
+/**
+ * @brief get the factors of a coefficient matrix, factoring it if it is not cached
+ * @param coefficients the coefficient matrix, without the constants
+ * @return the factors, shared with the cache
+ */
+FactorizationCache::Factors FactorizationCache::get(ConstMatrixView coefficients) {
+    std::uint64_t key = hasher(coefficients);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto range = index.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (matches(it->second->coefficients, coefficients)) {
+                entries.splice(entries.begin(), entries, it->second);
+                return it->second->factors;
+            }
+        }
+    }
+
+    Factors factors;
+    if (coefficients.rows() == 0 || coefficients.cols() == 0 || coefficients.rows() < coefficients.cols())
+        return factors;
+    if (coefficients.isSquare())
+        factors.lu = std::make_shared<const LUDecomposition>(coefficients);
+    else
+        factors.qr = std::make_shared<const QRDecomposition>(coefficients);
+
+    std::size_t size = (std::size_t) 2 * coefficients.rows() * coefficients.cols();
+    if (size > maxValues)
+        return factors;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto range = index.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (matches(it->second->coefficients, coefficients))
+            return it->second->factors;
+    }
+    evict(size);
+    entries.push_front({key, Matrix(coefficients), factors});
+    index.emplace(key, entries.begin());
+    values += size;
+    return factors;
+}
+
+/**
+ * @brief drop every entry
+ */
+void FactorizationCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    values = 0;
+}
+
+/**
+ * @brief change how many doubles the entries may hold, dropping the least recently used ones that no longer fit
+ * @param maxValues the number of doubles, 0 keeps nothing
+ */
+void FactorizationCache::setMaxValues(std::size_t maxValues) {
+    std::lock_guard<std::mutex> lock(mutex);
+    FactorizationCache::maxValues = maxValues;
+    evict(0);
+}
+
+/**
+ * @brief get the number of cached matrices
+ * @return the number of entries
+ */
+std::size_t FactorizationCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+/**
+ * @brief hash the size and values of a matrix with FNV-1a
+ * @details 0 and -0 hash the same, as they compare equal
+ * @param coefficients the matrix to hash
+ * @return the hash
+ */
+std::uint64_t FactorizationCache::hash(ConstMatrixView coefficients) {
+    const std::uint64_t prime = 1099511628211ULL;
+    std::uint64_t result = 14695981039346656037ULL;
+    auto mix = [&](std::uint64_t word) {
+        for (int i = 0; i < 8; i++) {
+            result ^= (word >> (8 * i)) & 0xff;
+            result *= prime;
+        }
+    };
+
+    mix(coefficients.rows());
+    mix(coefficients.cols());
+    for (int row = 0; row < coefficients.rows(); row++) {
+        const double *current = coefficients.rowData(row);
+        for (int col = 0; col < coefficients.cols(); col++) {
+            double value = current[col] == 0 ? 0 : current[col];
+            std::uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            mix(bits);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief drop the least recently used entries until there is room for more values, the lock must be held
+ * @param size the number of doubles to make room for
+ */
+void FactorizationCache::evict(std::size_t size) {
+    while (!entries.empty() && values + size > maxValues) {
+        const Entry &oldest = entries.back();
+        auto oldRange = index.equal_range(oldest.key);
+        for (auto it = oldRange.first; it != oldRange.second; ++it) {
+            if (it->second == std::prev(entries.end())) {
+                index.erase(it);
+                break;
+            }
+        }
+        values -= (std::size_t) 2 * oldest.coefficients.getRows() * oldest.coefficients.getCols();
+        entries.pop_back();
+    }
+}
+
+/**
+ * @brief check that a cached matrix is the one asked for, not just one with the same hash
+ * @param stored the coefficients of an entry
+ * @param coefficients the matrix asked for
+ * @return true if the sizes and values are equal
+ */
+bool FactorizationCache::matches(const Matrix &stored, ConstMatrixView coefficients) {
+    if (stored.getRows() != coefficients.rows() || stored.getCols() != coefficients.cols())
+        return false;
+    for (int row = 0; row < coefficients.rows(); row++) {
+        const double *current = coefficients.rowData(row);
+        for (int col = 0; col < coefficients.cols(); col++) {
+            if (stored(row, col) != current[col])
+                return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,347 @@
+/**
+ * @brief This class solves large linear systems Ax = b iteratively
+ *
+ * @details Conjugate gradient, BiCGSTAB and restarted GMRES, all starting from
+ * x = 0. CG needs a symmetric preconditioner, which ILU(0) only is for a
+ * symmetric A. BiCGSTAB and GMRES are right preconditioned so the residual
+ * they track is that of the system itself. The result always reports the
+ * residual of the returned x.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "../../../include/model/matrices/IterativeSolver.h"
+
+namespace {
+    double dot(const std::vector<double> &x, const std::vector<double> &y) {
+        double sum = 0;
+        for (size_t i = 0; i < x.size(); i++)
+            sum += x[i] * y[i];
+        return sum;
+    }
+
+    double norm(const std::vector<double> &x) {
+        return std::sqrt(dot(x, x));
+    }
+
+    // y += alpha * x
+    void addScaled(std::vector<double> &y, double alpha, const std::vector<double> &x) {
+        for (size_t i = 0; i < y.size(); i++)
+            y[i] += alpha * x[i];
+    }
+}
+
+/**
+ * @brief Construct a solver for a sparse system
+ * @param a the square matrix of the system
+ */
+IterativeSolver::IterativeSolver(const SparseMatrix &a) : a(a) {
+    if (a.getRows() != a.getCols())
+        throw std::runtime_error("can not solve a system with a non square matrix");
+    diagonal.assign(a.getRows(), -1);
+    const std::vector<int> &rowStart = a.getRowStart();
+    const std::vector<int> &colIndex = a.getColIndex();
+    for (int row = 0; row < a.getRows(); row++) {
+        for (int k = rowStart[row]; k < rowStart[row + 1]; k++) {
+            if (colIndex[k] == row)
+                diagonal[row] = k;
+        }
+    }
+}
+
+/**
+ * @brief Construct a solver for a dense system, it is stored in sparse form
+ * @param a the square matrix of the system
+ */
+IterativeSolver::IterativeSolver(const Matrix &a) : IterativeSolver(SparseMatrix(a)) {}
+
+/**
+ * @brief solve Ax = b
+ * @param b the right hand side
+ * @param options the method, preconditioner, tolerance and iteration limits
+ * @return the last x, if it converged, the number of iterations and the relative residual
+ */
+IterativeSolver::Result IterativeSolver::solve(const std::vector<double> &b, const Options &options) {
+    if ((int) b.size() != a.getRows())
+        throw std::runtime_error("matrix dimensions are incompatable for this operation");
+
+    // the factors are kept for the next right hand side
+    if (options.preconditioner == Preconditioner::ILU0 && lu.empty())
+        factorILU0();
+
+    Result result;
+    if (norm(b) == 0) {
+        result.x.assign(b.size(), 0);
+        result.converged = true;
+        result.iterations = 0;
+        result.residual = 0;
+        return result;
+    }
+
+    switch (options.method) {
+        case Method::ConjugateGradient:
+            result = conjugateGradient(b, options);
+            break;
+        case Method::BiCGSTAB:
+            result = biCGSTAB(b, options);
+            break;
+        case Method::GMRES:
+            result = gmres(b, options);
+            break;
+    }
+
+    // report the true residual, the recurrences of the methods can drift from it
+    std::vector<double> r = a.multiply(result.x);
+    for (size_t i = 0; i < r.size(); i++)
+        r[i] = b[i] - r[i];
+    result.residual = norm(r) / norm(b);
+    result.converged = result.residual <= options.tolerance;
+    return result;
+}
+
+/**
+ * @brief factor A ~ LU keeping only the non-zeros of A
+ * @details L has a unit diagonal, both factors are stored in place of A
+ */
+void IterativeSolver::factorILU0() {
+    const std::vector<int> &rowStart = a.getRowStart();
+    const std::vector<int> &colIndex = a.getColIndex();
+    std::vector<double> factors = a.getValues();
+
+    // position of each column in the current row, -1 when it is not in the pattern
+    std::vector<int> position(a.getCols(), -1);
+    for (int row = 0; row < a.getRows(); row++) {
+        if (diagonal[row] == -1)
+            throw std::runtime_error("ILU(0) needs every diagonal entry of the matrix");
+        for (int k = rowStart[row]; k < rowStart[row + 1]; k++)
+            position[colIndex[k]] = k;
+
+        for (int k = rowStart[row]; k < rowStart[row + 1] && colIndex[k] < row; k++) {
+            int pivot = colIndex[k];
+            factors[k] /= factors[diagonal[pivot]];
+            for (int j = diagonal[pivot] + 1; j < rowStart[pivot + 1]; j++) {
+                if (position[colIndex[j]] != -1)
+                    factors[position[colIndex[j]]] -= factors[k] * factors[j];
+            }
+        }
+        if (factors[diagonal[row]] == 0)
+            throw std::runtime_error("ILU(0) found a zero pivot");
+
+        for (int k = rowStart[row]; k < rowStart[row + 1]; k++)
+            position[colIndex[k]] = -1;
+    }
+    lu.swap(factors);
+}
+
+/**
+ * @brief apply the inverse of the preconditioner, z = M^-1 r
+ * @param preconditioner which M to use
+ * @param r the vector to precondition
+ * @param z the result
+ */
+void IterativeSolver::precondition(Preconditioner preconditioner, const std::vector<double> &r, std::vector<double> &z) const {
+    const std::vector<int> &rowStart = a.getRowStart();
+    const std::vector<int> &colIndex = a.getColIndex();
+    int n = r.size();
+    z.resize(n);
+
+    switch (preconditioner) {
+        case Preconditioner::None:
+            z = r;
+            break;
+        case Preconditioner::Jacobi:
+            for (int i = 0; i < n; i++) {
+                double d = diagonal[i] == -1 ? 0 : a.getValues()[diagonal[i]];
+                z[i] = d == 0 ? r[i] : r[i] / d;
+            }
+            break;
+        case Preconditioner::ILU0:
+            // solve Ly = r, then Uz = y
+            for (int i = 0; i < n; i++) {
+                double sum = r[i];
+                for (int k = rowStart[i]; k < diagonal[i]; k++)
+                    sum -= lu[k] * z[colIndex[k]];
+                z[i] = sum;
+            }
+            for (int i = n - 1; i >= 0; i--) {
+                double sum = z[i];
+                for (int k = diagonal[i] + 1; k < rowStart[i + 1]; k++)
+                    sum -= lu[k] * z[colIndex[k]];
+                z[i] = sum / lu[diagonal[i]];
+            }
+            break;
+    }
+}
+
+/**
+ * @brief preconditioned conjugate gradient, for symmetric positive definite A
+ */
+IterativeSolver::Result IterativeSolver::conjugateGradient(const std::vector<double> &b, const Options &options) const {
+    int n = b.size();
+    double target = options.tolerance * norm(b);
+    Result result{std::vector<double>(n, 0), false, 0, 1};
+
+    std::vector<double> r = b;
+    std::vector<double> z;
+    precondition(options.preconditioner, r, z);
+    std::vector<double> p = z;
+    double rz = dot(r, z);
+
+    while (result.iterations < options.maxIterations && norm(r) > target) {
+        std::vector<double> ap = a.multiply(p);
+        double pap = dot(p, ap);
+        if (pap == 0)
+            break;
+        double alpha = rz / pap;
+        addScaled(result.x, alpha, p);
+        addScaled(r, -alpha, ap);
+        result.iterations++;
+
+        precondition(options.preconditioner, r, z);
+        double next = dot(r, z);
+        double beta = next / rz;
+        rz = next;
+        for (int i = 0; i < n; i++)
+            p[i] = z[i] + beta * p[i];
+    }
+    return result;
+}
+
+/**
+ * @brief right preconditioned BiCGSTAB, for general A
+ */
+IterativeSolver::Result IterativeSolver::biCGSTAB(const std::vector<double> &b, const Options &options) const {
+    int n = b.size();
+    double target = options.tolerance * norm(b);
+    Result result{std::vector<double>(n, 0), false, 0, 1};
+
+    std::vector<double> r = b;
+    const std::vector<double> shadow = r;
+    std::vector<double> p(n, 0), v(n, 0), s(n), t, pHat, sHat;
+    double rho = 1, alpha = 1, omega = 1;
+
+    while (result.iterations < options.maxIterations && norm(r) > target) {
+        double next = dot(shadow, r);
+        // breakdown, the shadow residual became orthogonal to r
+        if (next == 0 || omega == 0)
+            break;
+        double beta = (next / rho) * (alpha / omega);
+        rho = next;
+        for (int i = 0; i < n; i++)
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+
+        precondition(options.preconditioner, p, pHat);
+        v = a.multiply(pHat);
+        double shadowV = dot(shadow, v);
+        if (shadowV == 0)
+            break;
+        alpha = rho / shadowV;
+        for (int i = 0; i < n; i++)
+            s[i] = r[i] - alpha * v[i];
+        result.iterations++;
+
+        if (norm(s) <= target) {
+            addScaled(result.x, alpha, pHat);
+            r = s;
+            break;
+        }
+
+        precondition(options.preconditioner, s, sHat);
+        t = a.multiply(sHat);
+        double tt = dot(t, t);
+        omega = tt == 0 ? 0 : dot(t, s) / tt;
+        for (int i = 0; i < n; i++) {
+            result.x[i] += alpha * pHat[i] + omega * sHat[i];
+            r[i] = s[i] - omega * t[i];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief right preconditioned GMRES, restarted every options.restart iterations
+ * @details the least squares problem of each cycle is kept upper triangular with Givens rotations
+ */
+IterativeSolver::Result IterativeSolver::gmres(const std::vector<double> &b, const Options &options) const {
+    int n = b.size();
+    int m = std::max(1, std::min(options.restart, n));
+    double target = options.tolerance * norm(b);
+    Result result{std::vector<double>(n, 0), false, 0, 1};
+
+    std::vector<std::vector<double>> basis(m + 1, std::vector<double>(n));
+    std::vector<std::vector<double>> hessenberg(m + 1, std::vector<double>(m));
+    std::vector<double> cs(m), sn(m), g(m + 1), y(m);
+    std::vector<double> w, z;
+
+    while (result.iterations < options.maxIterations) {
+        std::vector<double> r = a.multiply(result.x);
+        for (int i = 0; i < n; i++)
+            r[i] = b[i] - r[i];
+        double beta = norm(r);
+        if (beta <= target)
+            break;
+
+        for (int i = 0; i < n; i++)
+            basis[0][i] = r[i] / beta;
+        std::fill(g.begin(), g.end(), 0);
+        g[0] = beta;
+
+        int k = 0;
+        while (k < m && result.iterations < options.maxIterations) {
+            // extend the basis with A M^-1 v_k, orthogonalised by modified Gram-Schmidt
+            precondition(options.preconditioner, basis[k], z);
+            w = a.multiply(z);
+            for (int j = 0; j <= k; j++) {
+                hessenberg[j][k] = dot(w, basis[j]);
+                addScaled(w, -hessenberg[j][k], basis[j]);
+            }
+            double subdiagonal = norm(w);
+            hessenberg[k + 1][k] = subdiagonal;
+            if (subdiagonal != 0) {
+                for (int i = 0; i < n; i++)
+                    basis[k + 1][i] = w[i] / subdiagonal;
+            }
+
+            for (int j = 0; j < k; j++) {
+                double h = cs[j] * hessenberg[j][k] + sn[j] * hessenberg[j + 1][k];
+                hessenberg[j + 1][k] = -sn[j] * hessenberg[j][k] + cs[j] * hessenberg[j + 1][k];
+                hessenberg[j][k] = h;
+            }
+            double radius = std::hypot(hessenberg[k][k], hessenberg[k + 1][k]);
+            cs[k] = radius == 0 ? 1 : hessenberg[k][k] / radius;
+            sn[k] = radius == 0 ? 0 : hessenberg[k + 1][k] / radius;
+            hessenberg[k][k] = radius;
+            hessenberg[k + 1][k] = 0;
+            g[k + 1] = -sn[k] * g[k];
+            g[k] = cs[k] * g[k];
+
+            k++;
+            result.iterations++;
+            // |g[k]| is the residual norm so far, the basis stops growing once x is exact
+            if (std::abs(g[k]) <= target || subdiagonal == 0)
+                break;
+        }
+
+        // solve the triangular system for y, then x += M^-1 V y
+        for (int i = k - 1; i >= 0; i--) {
+            double sum = g[i];
+            for (int j = i + 1; j < k; j++)
+                sum -= hessenberg[i][j] * y[j];
+            y[i] = hessenberg[i][i] == 0 ? 0 : sum / hessenberg[i][i];
+        }
+        w.assign(n, 0);
+        for (int j = 0; j < k; j++)
+            addScaled(w, y[j], basis[j]);
+        precondition(options.preconditioner, w, z);
+        addScaled(result.x, 1, z);
+
+        if (std::abs(g[k]) <= target)
+            break;
+    }
+    return result;
+}
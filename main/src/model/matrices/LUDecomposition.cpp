@@ -0,0 +1,215 @@
+/**
+ * @brief This class stores the LU factorization of a square matrix
+ *
+ * @details The matrix is factored once as PA = LU with partial pivoting, in
+ * O(n^3). The factors then give the determinant in O(n), solve a system in
+ * O(n^2) and the inverse in O(n^3). L (unit diagonal) and U are packed into
+ * one row-major n x n buffer.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "../../../include/model/matrices/LUDecomposition.h"
+
+/**
+ * @brief factor a square matrix
+ * @details a pivot smaller than the rounding error of the elimination marks the
+ * matrix as singular, so singular integer matrices get a determinant of exactly 0
+ * @param values the matrix, or a square block of one
+ */
+LUDecomposition::LUDecomposition(ConstMatrixView values) {
+    n = values.rows();
+    if (n == 0 || !values.isSquare())
+        throw std::runtime_error("can not factor a non square matrix");
+
+    lu.resize((size_t) n * n);
+    pivots.resize(n);
+    sign = 1;
+    singular = false;
+
+    double largest = 0;
+    for (int row = 0; row < n; row++) {
+        for (int col = 0; col < n; col++) {
+            lu[(size_t) row * n + col] = values(row, col);
+            largest = std::max(largest, std::abs(values(row, col)));
+        }
+    }
+    const double tolerance = n * std::numeric_limits<double>::epsilon() * largest;
+
+    for (int k = 0; k < n; k++) {
+        // pick the row with the largest entry in column k as the pivot
+        int pivot = k;
+        for (int row = k + 1; row < n; row++) {
+            if (std::abs(lu[(size_t) row * n + k]) > std::abs(lu[(size_t) pivot * n + k]))
+                pivot = row;
+        }
+        pivots[k] = pivot;
+        if (pivot != k) {
+            for (int col = 0; col < n; col++)
+                std::swap(lu[(size_t) k * n + col], lu[(size_t) pivot * n + col]);
+            sign = -sign;
+        }
+
+        double *pivotRow = &lu[(size_t) k * n];
+        if (std::abs(pivotRow[k]) <= tolerance) {
+            // the column is already eliminated, nothing to do below it
+            singular = true;
+            continue;
+        }
+
+        // eliminate column k below the pivot, one row at a time so the inner loop is contiguous
+        for (int row = k + 1; row < n; row++) {
+            double *current = &lu[(size_t) row * n];
+            double multiple = current[k] / pivotRow[k];
+            current[k] = multiple;
+            if (multiple != 0) {
+                for (int col = k + 1; col < n; col++)
+                    current[col] -= multiple * pivotRow[col];
+            }
+        }
+    }
+}
+
+/**
+ * @brief get the number of rows (and columns) of the factored matrix
+ * @return the size of the matrix
+ */
+int LUDecomposition::size() const {
+    return n;
+}
+
+/**
+ * @brief check if the factored matrix is singular
+ * @return true if a pivot was zero up to rounding
+ */
+bool LUDecomposition::isSingular() const {
+    return singular;
+}
+
+/**
+ * @brief the determinant is the product of the pivots
+ * @return the determinant of the factored matrix, 0 if it is singular
+ */
+double LUDecomposition::determinant() const {
+    if (singular)
+        return 0;
+    double det = sign;
+    for (int k = 0; k < n; k++)
+        det *= lu[(size_t) k * n + k];
+    return det;
+}
+
+/**
+ * @brief solve Ax = b by forward and back substitution
+ * @param b the right hand side
+ * @return the solution x
+ */
+std::vector<double> LUDecomposition::solve(const std::vector<double> &b) const {
+    if ((int) b.size() != n)
+        throw std::runtime_error("matrix dimensions are incompatable for this operation");
+    if (singular)
+        throw std::runtime_error("The system does not have a unique solution");
+
+    std::vector<double> x = b;
+    substitute(x.data());
+    return x;
+}
+
+/**
+ * @brief solve AX = B for many right hand sides at once
+ * @details the substitution goes row by row through all the right hand sides,
+ * so each row of the factors is read once rather than once per column of B
+ * @param b the right hand sides, one per column
+ * @return the solutions, one per column
+ */
+Matrix LUDecomposition::solve(ConstMatrixView b) const {
+    if (b.rows() != n)
+        throw std::runtime_error("matrix dimensions are incompatable for this operation");
+    if (singular)
+        throw std::runtime_error("The system does not have a unique solution");
+
+    Matrix x(b);
+    int count = b.cols();
+    if (count == 0)
+        return x;
+    for (int k = 0; k < n; k++) {
+        if (pivots[k] != k)
+            x.swapRows(k, pivots[k]);
+    }
+    for (int row = 1; row < n; row++) {
+        const double *current = &lu[(size_t) row * n];
+        double *result = &x(row, 0);
+        for (int col = 0; col < row; col++) {
+            if (current[col] == 0)
+                continue;
+            const double *known = &x(col, 0);
+            for (int j = 0; j < count; j++)
+                result[j] -= current[col] * known[j];
+        }
+    }
+    for (int row = n - 1; row >= 0; row--) {
+        const double *current = &lu[(size_t) row * n];
+        double *result = &x(row, 0);
+        for (int col = row + 1; col < n; col++) {
+            if (current[col] == 0)
+                continue;
+            const double *known = &x(col, 0);
+            for (int j = 0; j < count; j++)
+                result[j] -= current[col] * known[j];
+        }
+        for (int j = 0; j < count; j++)
+            result[j] /= current[row];
+    }
+    return x;
+}
+
+/**
+ * @brief invert the matrix by solving for each column of the identity
+ * @return the inverse
+ */
+Matrix LUDecomposition::inverse() const {
+    if (singular)
+        throw std::runtime_error("The inverse does not exist for this matrix");
+
+    Matrix result(n, n);
+    std::vector<double> column(n);
+    for (int col = 0; col < n; col++) {
+        std::fill(column.begin(), column.end(), 0);
+        column[col] = 1;
+        substitute(column.data());
+        for (int row = 0; row < n; row++)
+            result(row, col) = column[row];
+    }
+    return result;
+}
+
+/**
+ * @brief apply the row swaps, then solve Ly = Pb and Ux = y in place
+ * @param x the right hand side on input, the solution on output
+ */
+void LUDecomposition::substitute(double *x) const {
+    for (int k = 0; k < n; k++) {
+        if (pivots[k] != k)
+            std::swap(x[k], x[pivots[k]]);
+    }
+    for (int row = 1; row < n; row++) {
+        const double *current = &lu[(size_t) row * n];
+        double sum = x[row];
+        for (int col = 0; col < row; col++)
+            sum -= current[col] * x[col];
+        x[row] = sum;
+    }
+    for (int row = n - 1; row >= 0; row--) {
+        const double *current = &lu[(size_t) row * n];
+        double sum = x[row];
+        for (int col = row + 1; col < n; col++)
+            sum -= current[col] * x[col];
+        x[row] = sum / current[row];
+    }
+}
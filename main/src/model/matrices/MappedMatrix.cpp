@@ -0,0 +1,110 @@
+/**
+ * @brief This class gives read-only access to a matrix stored in a file
+ *
+ * @details On systems without mmap the file is read into memory instead,
+ * which behaves the same apart from the up front cost.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_MATRIX_MMAP
+#endif
+
+#include "../../../include/model/matrices/MappedMatrix.h"
+#include "../../../include/model/matrices/MatrixFile.h"
+
+namespace {
+    const std::size_t headerSize = 32;
+}
+
+/**
+ * @brief open a binary matrix file
+ * @param path the file written by MatrixFile::write or in any other layout of the format
+ */
+MappedMatrix::MappedMatrix(const std::string &path) {
+#ifdef MAPPED_MATRIX_MMAP
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        throw std::runtime_error("can not open matrix file " + path);
+    struct stat status;
+    if (fstat(file, &status) != 0) {
+        close(file);
+        throw std::runtime_error("can not open matrix file " + path);
+    }
+    size = status.st_size;
+    if (size >= headerSize) {
+        void *address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (address != MAP_FAILED) {
+            data = static_cast<const char *>(address);
+            mapped = true;
+        }
+    }
+    close(file);
+#endif
+
+    if (!mapped) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+            throw std::runtime_error("can not open matrix file " + path);
+        buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        data = buffer.data();
+        size = buffer.size();
+    }
+
+    try {
+        MatrixFile::Header header = MatrixFile::parseHeader(data, size);
+        if (size - headerSize < header.rows * header.cols * MatrixFile::valueSize(header.dataType))
+            throw std::runtime_error("matrix file " + path + " is shorter than its header says");
+        rows = header.rows;
+        cols = header.cols;
+
+        const char *start = data + headerSize;
+        if (header.dataType == MatrixFile::DataType::Float64 && header.layout == MatrixFile::Layout::RowMajor) {
+            values = reinterpret_cast<const double *>(start);
+        } else {
+            converted = MatrixFile::convert(header, start);
+            values = rows * cols == 0 ? nullptr : &converted(0, 0);
+        }
+    } catch (...) {
+#ifdef MAPPED_MATRIX_MMAP
+        if (mapped)
+            munmap(const_cast<char *>(data), size);
+#endif
+        throw;
+    }
+}
+
+/**
+ * @brief unmap the file
+ */
+MappedMatrix::~MappedMatrix() {
+#ifdef MAPPED_MATRIX_MMAP
+    if (mapped)
+        munmap(const_cast<char *>(data), size);
+#endif
+}
+
+/**
+ * @brief get the values of the matrix
+ * @return a view of the values, valid while this object exists
+ */
+ConstMatrixView MappedMatrix::view() const {
+    return ConstMatrixView(values, rows, cols, cols);
+}
+
+/**
+ * @brief check whether the values are read straight from the file
+ * @return true if the file is mapped and needed no conversion
+ */
+bool MappedMatrix::isMapped() const {
+    return mapped && values != nullptr && converted.getRows() * converted.getCols() == 0;
+}
@@ -4,14 +4,93 @@
  * @version 0.1
  */
 
+#include <algorithm>
+
 #include "../../../include/model/matrices/Matrix.h"
+#include "../../../include/model/matrices/LUDecomposition.h"
+#include "../../../include/model/matrices/QRDecomposition.h"
+#include "../../../include/model/matrices/MatrixMultiply.h"
+#include "../../../include/model/utilities/CpuFeatures.h"
+#include "../../../include/model/utilities/WorkerPool.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MATRIX_X86
+#include <immintrin.h>
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+#endif
+
+namespace {
+    // row operations set values smaller than this to 0
+    const double zeroTolerance = 0.0001;
+
+    // reduceToRREF splits the row updates of each pivot over threads from this many values
+    const long parallelSize = 256 * 256;
+
+    // current += multiple * other over count values, dropping values that become (almost) zero
+    typedef void (*RowUpdate)(double *current, const double *other, double multiple, int count);
+
+    void portableRowUpdate(double *current, const double *other, double multiple, int count) {
+        for (int i = 0; i < count; i++) {
+            current[i] += other[i] * multiple;
+            if (std::abs(current[i]) < zeroTolerance) current[i] = 0;
+        }
+    }
+
+#ifdef MATRIX_X86
+    AVX2_TARGET void avx2RowUpdate(double *current, const double *other, double multiple, int count) {
+        __m256d scale = _mm256_set1_pd(multiple);
+        __m256d tolerance = _mm256_set1_pd(zeroTolerance);
+        __m256d sign = _mm256_set1_pd(-0.0);
+        int i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m256d value = _mm256_fmadd_pd(_mm256_loadu_pd(other + i), scale, _mm256_loadu_pd(current + i));
+            __m256d keep = _mm256_cmp_pd(_mm256_andnot_pd(sign, value), tolerance, _CMP_GE_OQ);
+            _mm256_storeu_pd(current + i, _mm256_and_pd(value, keep));
+        }
+        portableRowUpdate(current + i, other + i, multiple, count - i);
+    }
+#endif
+
+    RowUpdate selectRowUpdate() {
+#ifdef MATRIX_X86
+        if (CpuFeatures::hasAvx2())
+            return avx2RowUpdate;
+#endif
+        return portableRowUpdate;
+    }
+
+    const RowUpdate rowUpdate = selectRowUpdate();
+}
 
 /**
  * @brief Construct a new Matrix will given values
  * @param input the 2D set of values to assign to the new Matrix
  */
-Matrix::Matrix(std::vector<std::vector<double>> input) {
-    matrix = input;
+Matrix::Matrix(const std::vector<std::vector<double>> &input) {
+    rows = input.size();
+    cols = input.empty() ? 0 : input[0].size();
+    values.resize((size_t) rows * cols);
+    for (int row = 0; row < rows; row++) {
+        if ((int) input[row].size() != cols)
+            throw std::runtime_error("matrix rows must all have the same length");
+        std::copy(input[row].begin(), input[row].end(), values.begin() + (size_t) row * cols);
+    }
+}
+
+/**
+ * @brief Construct a new Matrix filled with zeros
+ * @param rows the number of rows
+ * @param cols the number of columns
+ */
+Matrix::Matrix(int rows, int cols) : rows(rows), cols(cols), values((size_t) rows * cols) {}
+
+/**
+ * @brief Construct a new Matrix with a copy of the values in a view
+ * @param view the rows, columns or block to copy
+ */
+Matrix::Matrix(ConstMatrixView view) : Matrix(view.rows(), view.cols()) {
+    for (int row = 0; row < rows; row++)
+        std::copy(view.rowData(row), view.rowData(row) + cols, values.begin() + (size_t) row * cols);
 }
 
 /**
@@ -19,15 +98,13 @@ Matrix::Matrix(std::vector<std::vector<double>> input) {
  * @param other the matrix to be added to the current one
  * @return Matrix the resulting matrix from adding this matrix + other matrix 
  */
-Matrix Matrix::operator+(const Matrix &other) {
-    if (matrix.size() == other.matrix.size() && matrix[0].size() == other.matrix[0].size()) {
+Matrix Matrix::operator+(const Matrix &other) const {
+    if (rows == other.rows && cols == other.cols) {
         // Matrix sizes are compatable; add matrices
-        std::vector<std::vector<double>> result = matrix;
-        for (int row = 0; row < matrix.size(); row++) {
-            for (int col = 0; col < matrix[0].size(); col++)
-                result[row][col] += other.matrix[row][col];
-        }
-        return Matrix(result);
+        Matrix result = *this;
+        for (size_t i = 0; i < values.size(); i++)
+            result.values[i] += other.values[i];
+        return result;
     } else
         throw std::runtime_error("matrix dimensions are incompatable for this operation");
 }
@@ -37,15 +114,13 @@ Matrix Matrix::operator+(const Matrix &other) {
  * @param other the matrix to be subtracted from the current one
  * @return Matrix the resulting matrix from subtracting other matrix from this matrix
  */
-Matrix Matrix::operator-(const Matrix &other) {
-    if (matrix.size() == other.matrix.size() && matrix[0].size() == other.matrix[0].size()) {
+Matrix Matrix::operator-(const Matrix &other) const {
+    if (rows == other.rows && cols == other.cols) {
         // Matrix sizes are compatable; subtract matrices
-        std::vector<std::vector<double>> result = matrix;
-        for (int row = 0; row < matrix.size(); row++) {
-            for (int col = 0; col < matrix[0].size(); col++)
-                result[row][col] -= other.matrix[row][col];
-        }
-        return Matrix(result);
+        Matrix result = *this;
+        for (size_t i = 0; i < values.size(); i++)
+            result.values[i] -= other.values[i];
+        return result;
     } else
         throw std::runtime_error("matrix dimensions are incompatable for this operation");
 }
@@ -55,22 +130,12 @@ Matrix Matrix::operator-(const Matrix &other) {
  * @param other the matrix to be multiplied with the current one
  * @return Matrix the resulting matrix from this matrix dot producted with other matrix 
  */
-Matrix Matrix::operator*(const Matrix &other) {
-    if (matrix.size() == other.matrix[0].size() && matrix[0].size() == other.matrix.size()) {
+Matrix Matrix::operator*(const Matrix &other) const {
+    if (cols == other.rows) {
         // Matrix sizes are compatable; multiply matrices
-        std::vector<std::vector<double>> result;
-        result.resize(matrix.size(), std::vector<double>(other.matrix[0].size()));
-        int num_terms = matrix[0].size();
-        int current_element = 0;
-        for (int row = 0; row < matrix.size(); row++) {
-            for (int col = 0; col < other.matrix[0].size(); col++) {
-                current_element = 0;
-                for (int k = 0; k < num_terms; k++)
-                    current_element += matrix[row][k] * other.matrix[k][col];
-                result[row][col] = current_element;
-            }
-        }
-        return Matrix(result);
+        Matrix result(rows, other.cols);
+        MatrixMultiply::multiply(view(), other.view(), result.view());
+        return result;
     } else
         throw std::runtime_error("matrix dimensions are incompatable for this operation");
 }
@@ -79,16 +144,15 @@ Matrix Matrix::operator*(const Matrix &other) {
  * @brief transposes the current matrix
  * @return true if successful. else false
  */
-Matrix Matrix::transpose() {
+Matrix Matrix::transpose() const {
     if (!isSquare())
         throw std::runtime_error("can not transpose non square matrix");
-    std::vector<std::vector<double>> result;
-    result.resize(matrix.size(), std::vector<double>(matrix[0].size()));
-    for (int row = 0; row < matrix.size(); row++) {
-        for (int col = 0; col < matrix[0].size(); col++)
-            result[row][col] = matrix[col][row];
+    Matrix result(cols, rows);
+    for (int row = 0; row < rows; row++) {
+        for (int col = 0; col < cols; col++)
+            result(col, row) = (*this)(row, col);
     }
-    return Matrix(result);
+    return result;
 }
 
 
@@ -96,14 +160,11 @@ Matrix Matrix::transpose() {
  * @brief scaler multiplies the current matrix
  * @param scaler the scaler to multiply the matrix by 
  */
-Matrix Matrix::scalarMulitply(double scaler) {
-    std::vector<std::vector<double>> result;
-    result.resize(matrix.size(), std::vector<double>(matrix[0].size()));
-    for (int row = 0; row < matrix.size(); row++) {
-        for (int col = 0; col < matrix[0].size(); col++)
-            result[row][col] = matrix[row][col] * scaler;
-    }
-    return Matrix(result);
+Matrix Matrix::scalarMulitply(double scaler) const {
+    Matrix result = *this;
+    for (double &value: result.values)
+        value *= scaler;
+    return result;
 }
 
 /**
@@ -112,35 +173,24 @@ Matrix Matrix::scalarMulitply(double scaler) {
  * functions work together to recursively compute larger matrices 
  * @return the cofactor of the matrix at the given index
  */
-double Matrix::cofactor(int row, int col) {
+double Matrix::cofactor(int row, int col) const {
     if (!isSquare())
         throw std::runtime_error("can not compute cofactor of non square matrix");
-    if (matrix.size() < 3)
+    if (rows < 3)
         throw std::runtime_error("can not compute cofactor of matrix smaller than 3x3");
     row--;
     col--;   //convert row and col so that it matches vector indices
-    // Get the sub matrix of matrix defined by elements in different rows and columns than row, col 
-    std::vector<std::vector<double>> sub_matrix;
-    sub_matrix.resize(matrix.size() - 1, std::vector<double>(matrix[0].size() - 1));
-    for (int i = 0; i < matrix.size(); i++) {
-        for (int j = 0; j < matrix[0].size(); j++) {
-            if (i != row && j != col) {
-                if (i > row) {
-                    if (j > col)
-                        sub_matrix[i - 1][j - 1] = matrix[i][j];
-                    else
-                        sub_matrix[i - 1][j] = matrix[i][j];
-                } else {
-                    if (j > col)
-                        sub_matrix[i][j - 1] = matrix[i][j];
-                    else
-                        sub_matrix[i][j] = matrix[i][j];
-                }
-            }
-        }
-    }
+    // Get the sub matrix of matrix defined by elements in different rows and columns than row, col.
+    // It is made of the four blocks around the removed row and column
+    int below = rows - row - 1;
+    int right = cols - col - 1;
+    Matrix sub_matrix(rows - 1, cols - 1);
+    sub_matrix.block(0, 0, row, col).assign(block(0, 0, row, col));
+    sub_matrix.block(0, col, row, right).assign(block(0, col + 1, row, right));
+    sub_matrix.block(row, 0, below, col).assign(block(row + 1, 0, below, col));
+    sub_matrix.block(row, col, below, right).assign(block(row + 1, col + 1, below, right));
     // Compute the determinant of the sub matrix 
-    double det = Matrix(sub_matrix).determinant();
+    double det = sub_matrix.determinant();
     // Multiply determinant by proper sign to get the cofactor
     double cofactor = ((row + col) % 2 == 0) ? det : -1 * det;
     return cofactor;
@@ -148,46 +198,50 @@ double Matrix::cofactor(int row, int col) {
 
 /**
  * @brief finds the determinate of the current matrix
- * @details computes determinate of 2x2 matrix on the spot. Cofactor and determinate 
- * functions work together to recursively compute larger matrices 
+ * @details factors the matrix as PA = LU, the determinant is then the product
+ * of the pivots with the sign of the row swaps
  * @return the determinate of the matrix
  */
-double Matrix::determinant() {
+double Matrix::determinant() const {
     if (!isSquare()) {
         throw std::runtime_error("can not compute determinant of non square matrix");
     }
-    if (matrix.size() == 2)
-        return (matrix[0][0] * matrix[1][1] - matrix[0][1] * matrix[1][0]);
-    else {
-        int sum = 0;
-        for (int i = 0; i < matrix[0].size(); i++) {
-            sum += matrix[0][i] * cofactor(1, i + 1);
-        }
-        return sum;
-    }
+    return LUDecomposition(view()).determinant();
 }
 
 /**
  * @brief finds the inverse of the current matrix
+ * @details solves for each column of the identity with the LU factors of the matrix
  * @return the inverse matrix of the current matrix
  */
-Matrix Matrix::inverse() {
-    double det = determinant();
-    if (det == 0)
+Matrix Matrix::inverse() const {
+    if (!isSquare())
+        throw std::runtime_error("can not compute inverse of non square matrix");
+    LUDecomposition lu(view());
+    if (lu.isSingular())
         throw std::runtime_error("The inverse does not exist for this matrix");
-    else {
-        //Get Adjoint Matrix
-        std::vector<std::vector<double>> adj;
-        adj.resize(matrix.size(), std::vector<double>(matrix[0].size()));
-        for (int row = 0; row < matrix.size(); row++) {
-            for (int col = 0; col < matrix[0].size(); col++)
-                adj[row][col] = cofactor(row + 1, col + 1);
-        }
-        Matrix adjoint = Matrix(adj);
-        //Scalar  multiply adjoint matrix by 1/determinant to get inverse
-        Matrix inverse = adjoint.scalarMulitply(1 / det);
-        return inverse;
-    }
+    return lu.inverse();
+}
+
+/**
+ * @brief solves the system Ax = b where A is the current matrix
+ * @param b the right hand side of the system
+ * @return the solution x
+ */
+std::vector<double> Matrix::solve(const std::vector<double> &b) const {
+    if (!isSquare())
+        throw std::runtime_error("can not solve a system with a non square matrix");
+    return LUDecomposition(view()).solve(b);
+}
+
+/**
+ * @brief finds the x that minimises ||b - Ax|| where A is the current matrix
+ * @details uses the QR factorization of A, so A^T A is never formed
+ * @param b the right hand side of the system, one value per row
+ * @return the least squares solution x
+ */
+std::vector<double> Matrix::leastSquares(const std::vector<double> &b) const {
+    return QRDecomposition(view()).solve(b).x;
 }
 
 /**
@@ -197,9 +251,8 @@ Matrix Matrix::inverse() {
  * @param second_row the index of the row to be swapped with the first row
  */
 void Matrix::swapRows(int first_row, int second_row) {
-    std::vector<double> temp = matrix[first_row];
-    matrix[first_row] = matrix[second_row];
-    matrix[second_row] = temp;
+    if (first_row != second_row)
+        std::swap_ranges(row(first_row).data(), row(first_row).data() + cols, row(second_row).data());
 }
 
 /**
@@ -208,10 +261,11 @@ void Matrix::swapRows(int first_row, int second_row) {
  * @param row the index of the row to be scalar multiplied
  * @param scalar the number to multiply the row by
  */
-void Matrix::scalarMulitplyRow(int row, double scalar) {
-    for (int i = 0; i < matrix[0].size(); i++) {
-        matrix[row][i] *= scalar;
-        if (std::abs(matrix[row][i]) < 0.0001) matrix[row][i] = 0;
+void Matrix::scalarMulitplyRow(int row_index, double scalar) {
+    double *entries = row(row_index).data();
+    for (int i = 0; i < cols; i++) {
+        entries[i] *= scalar;
+        if (std::abs(entries[i]) < zeroTolerance) entries[i] = 0;
     }
 }
 
@@ -222,45 +276,52 @@ void Matrix::scalarMulitplyRow(int row, double scalar) {
  * @param scalar the number to multiply the row by
  */
 void Matrix::AddScalarMulitpleOfOtherRow(int current_row, int other_row, double multiple) {
-    for (int i = 0; i < matrix[0].size(); i++) {
-        matrix[current_row][i] += matrix[other_row][i] * multiple;
-        if (std::abs(matrix[current_row][i]) < 0.0001) matrix[current_row][i] = 0;
-    }
+    rowUpdate(row(current_row).data(), row(other_row).data(), multiple, cols);
 }
 
 /**
  * @brief reduces the current matrix to row-reduced echelon form
- * 
+ * @details the updates of the rows below (and later above) each pivot do not depend on
+ * each other, so on large matrices they are split over a pool of threads
  */
 void Matrix::reduceToRREF() {
-    int max;
-    int max_index;
-    int temp;
-    double multiple;
+    double max;
+    int max_index = 0;
     int pivot_row = 0;   //initialize to top row
     int pivot_col = 0;   //initialize to leftmost col
 
+    WorkerPool::Claim claim((long) rows * cols >= parallelSize);
+    WorkerPool &pool = claim.pool();
+
     //Reduce to REF
-    while (pivot_row < matrix.size() && pivot_col < matrix[0].size()) {
+    while (pivot_row < rows && pivot_col < cols) {
         // Find leftmost non-zero column
         max = 0;
         // Get highest absolute value in pivot_col under pivot_row
-        for (int i = pivot_row; i < matrix.size(); i++) {
-            if (abs(matrix[i][pivot_col]) > max) {
-                max = abs(matrix[i][pivot_col]);
+        for (int i = pivot_row; i < rows; i++) {
+            if (std::abs((*this)(i, pivot_col)) > max) {
+                max = std::abs((*this)(i, pivot_col));
                 max_index = i;
             }
         }
-        if (max == 0)    // Column entries under pivot_row are all zero. Go to next Col
+        if (max < zeroTolerance) {   // Column entries under pivot_row are all zero. Go to next Col
+            for (int i = pivot_row; i < rows; i++)
+                (*this)(i, pivot_col) = 0;
             pivot_col++;
-        else {
+        } else {
             // Put the row with highest value in current pivot_col to top (of unreduced rows) by swapping
             swapRows(pivot_row, max_index);
-            // Make entries in pivot_col below pivot_row = 0 by subtracting appropratiate multiple of pivot_row
-            for (int i = pivot_row + 1; i < matrix.size(); i++) {
-                multiple = -(matrix[i][pivot_col] / matrix[pivot_row][pivot_col]);
-                AddScalarMulitpleOfOtherRow(i, pivot_row, multiple);
-            }
+            // Make entries in pivot_col below pivot_row = 0 by subtracting appropratiate multiple of pivot_row.
+            // Left of pivot_col both rows are already 0, so only the rest of the row is updated
+            const double *pivot = &(*this)(pivot_row, pivot_col);
+            int width = cols - pivot_col;
+            pool.run(pivot_row + 1, rows, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    double *current = &(*this)(i, pivot_col);
+                    if (*current != 0)
+                        rowUpdate(current, pivot, -(*current / *pivot), width);
+                }
+            });
             pivot_row++;
             pivot_col++;
         }
@@ -268,16 +329,15 @@ void Matrix::reduceToRREF() {
 
     // Reduce to RREF
     double leading_entry;
-    int leading_indeces[matrix.size()];
     // Initialize leading indeces to -1 to represent no leading enttry in the row (found yet)
-    for (int i = 0; i < matrix.size(); i++) leading_indeces[i] = -1;
+    std::vector<int> leading_indeces(rows, -1);
 
     // Multiply rows such that all leading entries are 1
-    for (int i = 0; i < matrix.size(); i++) {
+    for (int i = 0; i < rows; i++) {
         leading_entry = 0;
-        for (int j = 0; j < matrix[0].size(); j++) {
-            if (matrix[i][j] != 0) {
-                leading_entry = matrix[i][j];
+        for (int j = 0; j < cols; j++) {
+            if ((*this)(i, j) != 0) {
+                leading_entry = (*this)(i, j);
                 leading_indeces[i] = j;
                 break;
             }
@@ -286,8 +346,8 @@ void Matrix::reduceToRREF() {
             scalarMulitplyRow(i, 1 / leading_entry);
     }
 
-    pivot_row = matrix.size() - 1;   //initialize to bottom row
-    pivot_col = matrix[0].size() - 1;   //initialize to rightmost col
+    pivot_row = rows - 1;   //initialize to bottom row
+    pivot_col = cols - 1;   //initialize to rightmost col
     // Make entries in pivot_col above pivot_row 0 by subtracting appropratiate multiple of pivot_row
     while (pivot_row > 0 && pivot_col > 0) {
         // Find rightmost column contatining leading 1
@@ -295,20 +355,25 @@ void Matrix::reduceToRREF() {
             pivot_row--;
         else {
             pivot_col = leading_indeces[pivot_row];
-            for (int i = 0; i < pivot_row; i++) {
-                multiple = -(matrix[i][pivot_col]);
-                AddScalarMulitpleOfOtherRow(i, pivot_row, multiple);
-            }
+            const double *pivot = &(*this)(pivot_row, pivot_col);
+            int width = cols - pivot_col;
+            pool.run(0, pivot_row, [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    double *current = &(*this)(i, pivot_col);
+                    if (*current != 0)
+                        rowUpdate(current, pivot, -(*current), width);
+                }
+            });
             pivot_row--;
             pivot_col--;
         }
     }
 
     // Fix -0's
-    for (int i = 0; i < matrix.size(); i++) {
-        for (int j = 0; j < matrix[0].size(); j++) {
-            if (matrix[i][j] == -0)
-                matrix[i][j] = 0;
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            if ((*this)(i, j) == -0)
+                (*this)(i, j) = 0;
         }
     }
 }
@@ -317,14 +382,87 @@ void Matrix::reduceToRREF() {
  * @brief returns the values of the matrix 
  * @return true if this matrix is square; false otherwise
  */
-bool Matrix::isSquare() {
-    return (matrix.size() == matrix[0].size());
+bool Matrix::isSquare() const {
+    return rows == cols;
+}
+
+/**
+ * @brief returns the number of rows of the matrix
+ * @return the number of rows
+ */
+int Matrix::getRows() const {
+    return rows;
+}
+
+/**
+ * @brief returns the number of columns of the matrix
+ * @return the number of columns
+ */
+int Matrix::getCols() const {
+    return cols;
+}
+
+/**
+ * @brief returns a view of the whole matrix
+ * @return the view, valid until the matrix is destroyed or reassigned
+ */
+MatrixView Matrix::view() {
+    return MatrixView(values.data(), rows, cols, cols);
+}
+
+ConstMatrixView Matrix::view() const {
+    return ConstMatrixView(values.data(), rows, cols, cols);
+}
+
+/**
+ * @brief returns a view of one row of the matrix
+ * @param row the index of the row
+ * @return the 1 x cols view of the row
+ */
+MatrixView Matrix::row(int row) {
+    return view().row(row);
+}
+
+ConstMatrixView Matrix::row(int row) const {
+    return view().row(row);
+}
+
+/**
+ * @brief returns a view of one column of the matrix
+ * @param col the index of the column
+ * @return the rows x 1 view of the column
+ */
+MatrixView Matrix::col(int col) {
+    return view().col(col);
+}
+
+ConstMatrixView Matrix::col(int col) const {
+    return view().col(col);
+}
+
+/**
+ * @brief returns a view of a rectangular part of the matrix
+ * @param row the first row of the block
+ * @param col the first column of the block
+ * @param num_rows the number of rows in the block
+ * @param num_cols the number of columns in the block
+ * @return the view of the block
+ */
+MatrixView Matrix::block(int row, int col, int num_rows, int num_cols) {
+    return view().block(row, col, num_rows, num_cols);
+}
+
+ConstMatrixView Matrix::block(int row, int col, int num_rows, int num_cols) const {
+    return view().block(row, col, num_rows, num_cols);
 }
 
 /**
  * @brief returns the values of the matrix 
  * @return values of the matrix
  */
-std::vector<std::vector<double>> Matrix::getValues() {
-    return matrix;
+std::vector<std::vector<double>> Matrix::getValues() const {
+    std::vector<std::vector<double>> result(rows);
+    for (int row = 0; row < rows; row++)
+        result[row].assign(values.begin() + (size_t) row * cols, values.begin() + (size_t) (row + 1) * cols);
+    return result;
 }
@@ -0,0 +1,271 @@
+/**
+ * @brief This class reads and writes matrices in files
+ *
+ * @details See MatrixFile.h for the binary format. CSV files are parsed in
+ * chunks of a fixed size, a value cut off at the end of a chunk is carried
+ * over to the next one.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../../../include/model/matrices/MatrixFile.h"
+
+namespace {
+    const char magic[4] = {'C', 'M', 'T', 'X'};
+    const std::uint32_t version = 1;
+    const std::uint64_t headerSize = 32;
+
+    // CSV input is read this many bytes at a time
+    const std::size_t chunkSize = 1 << 20;
+
+    bool isLittleEndian() {
+        const std::uint16_t one = 1;
+        char first;
+        std::memcpy(&first, &one, 1);
+        return first == 1;
+    }
+
+    template <typename T>
+    T readField(const char *data) {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void writeField(std::ostream &out, T value) {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+}
+
+/**
+ * @brief write a matrix as doubles in row-major order
+ * @param path the file to create or replace
+ * @param matrix the values to write
+ */
+void MatrixFile::write(const std::string &path, ConstMatrixView matrix) {
+    if (!isLittleEndian())
+        throw std::runtime_error("matrix files can only be written on little-endian machines");
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("can not create matrix file " + path);
+
+    out.write(magic, sizeof(magic));
+    writeField<std::uint32_t>(out, version);
+    writeField<std::uint32_t>(out, (std::uint32_t) DataType::Float64);
+    writeField<std::uint32_t>(out, (std::uint32_t) Layout::RowMajor);
+    writeField<std::uint64_t>(out, matrix.rows());
+    writeField<std::uint64_t>(out, matrix.cols());
+    for (int row = 0; row < matrix.rows(); row++)
+        out.write(reinterpret_cast<const char *>(matrix.rowData(row)), sizeof(double) * matrix.cols());
+
+    if (!out)
+        throw std::runtime_error("can not write matrix file " + path);
+}
+
+/**
+ * @brief read a binary matrix file into memory
+ * @param path the file to read
+ * @return the matrix, in any data type or layout the format allows
+ */
+Matrix MatrixFile::read(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("can not open matrix file " + path);
+
+    char headerData[headerSize];
+    in.read(headerData, headerSize);
+    Header header = parseHeader(headerData, in.gcount());
+
+    std::vector<char> values(header.rows * header.cols * valueSize(header.dataType));
+    in.read(values.data(), values.size());
+    if (in.gcount() != (std::streamsize) values.size())
+        throw std::runtime_error("matrix file " + path + " is shorter than its header says");
+    return convert(header, values.data());
+}
+
+/**
+ * @brief check and decode the header of a binary matrix file
+ * @param data the start of the file
+ * @param size the number of bytes available after data, at least the header must be there
+ * @return the header, the values start headerSize bytes after data
+ */
+MatrixFile::Header MatrixFile::parseHeader(const char *data, std::uint64_t size) {
+    if (!isLittleEndian())
+        throw std::runtime_error("matrix files can only be read on little-endian machines");
+    if (size < headerSize || std::memcmp(data, magic, sizeof(magic)) != 0)
+        throw std::runtime_error("not a matrix file");
+
+    Header header;
+    std::memcpy(header.magic, data, sizeof(magic));
+    header.version = readField<std::uint32_t>(data + 4);
+    header.dataType = (DataType) readField<std::uint32_t>(data + 8);
+    header.layout = (Layout) readField<std::uint32_t>(data + 12);
+    header.rows = readField<std::uint64_t>(data + 16);
+    header.cols = readField<std::uint64_t>(data + 24);
+
+    if (header.version != version)
+        throw std::runtime_error("unsupported matrix file version");
+    if (header.layout != Layout::RowMajor && header.layout != Layout::ColumnMajor)
+        throw std::runtime_error("unsupported matrix file layout");
+    valueSize(header.dataType);
+    if (header.rows > (std::uint64_t) std::numeric_limits<int>::max()
+            || header.cols > (std::uint64_t) std::numeric_limits<int>::max()
+            || (header.cols != 0 && header.rows > std::numeric_limits<std::uint64_t>::max() / 8 / header.cols))
+        throw std::runtime_error("matrix file is too large");
+    return header;
+}
+
+/**
+ * @brief get the number of bytes of one value
+ * @param dataType the data type of the values
+ * @return the size of a value in bytes
+ */
+std::uint64_t MatrixFile::valueSize(DataType dataType) {
+    switch (dataType) {
+        case DataType::Float64:
+            return 8;
+        case DataType::Float32:
+            return 4;
+        default:
+            throw std::runtime_error("unsupported matrix file data type");
+    }
+}
+
+/**
+ * @brief copy the values of a binary matrix file into a Matrix
+ * @param header the decoded header
+ * @param values the values that follow the header
+ * @return the matrix as doubles in row-major order
+ */
+Matrix MatrixFile::convert(const Header &header, const char *values) {
+    Matrix result(header.rows, header.cols);
+    std::uint64_t size = valueSize(header.dataType);
+    for (std::uint64_t i = 0; i < header.rows * header.cols; i++) {
+        double value = header.dataType == DataType::Float64 ? readField<double>(values + i * size)
+                                                            : readField<float>(values + i * size);
+        if (header.layout == Layout::RowMajor)
+            result(i / header.cols, i % header.cols) = value;
+        else
+            result(i % header.rows, i / header.rows) = value;
+    }
+    return result;
+}
+
+/**
+ * @brief read a matrix from a CSV file, one row per line
+ * @param path the file to read
+ * @return the matrix
+ */
+Matrix MatrixFile::readCsv(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("can not open CSV file " + path);
+    return readCsv(in);
+}
+
+/**
+ * @brief read a matrix from CSV, one row per line
+ * @details blank lines are skipped, every other line must have the same number of values
+ * @param in the CSV text
+ * @return the matrix
+ */
+Matrix MatrixFile::readCsv(std::istream &in) {
+    std::vector<double> values;
+    int cols = -1;
+    int rows = 0;
+    int rowValues = 0;
+    long line = 1;
+
+    // the text of a value that continues in the next chunk
+    std::string pending;
+    std::vector<char> chunk(chunkSize);
+
+    auto addValue = [&](const char *begin, const char *end) {
+        while (begin < end && isSpace(*begin)) begin++;
+        while (end > begin && isSpace(end[-1])) end--;
+        // strtod needs the field to end in a null
+        std::string field(begin, end);
+        char *stop = nullptr;
+        errno = 0;
+        double value = std::strtod(field.c_str(), &stop);
+        bool overflow = errno == ERANGE && std::abs(value) == HUGE_VAL;
+        if (field.empty() || stop != field.c_str() + field.size() || overflow)
+            throw std::runtime_error("invalid number on line " + std::to_string(line) + " of CSV");
+        values.push_back(value);
+        rowValues++;
+    };
+
+    auto endRow = [&]() {
+        if (rowValues == 0)
+            return;
+        if (cols == -1)
+            cols = rowValues;
+        else if (rowValues != cols)
+            throw std::runtime_error("line " + std::to_string(line) + " of CSV has " + std::to_string(rowValues)
+                                     + " values, expected " + std::to_string(cols));
+        rows++;
+        rowValues = 0;
+    };
+
+    // a field that is only spaces ends a blank line, anywhere else it is an error
+    auto endField = [&](const char *begin, const char *end, bool endOfLine) {
+        bool blank = true;
+        for (const char *c = begin; c < end; c++)
+            blank = blank && isSpace(*c);
+        if (!(blank && endOfLine && rowValues == 0))
+            addValue(begin, end);
+    };
+
+    while (in) {
+        in.read(chunk.data(), chunk.size());
+        std::size_t count = in.gcount();
+        const char *start = chunk.data();
+        const char *end = chunk.data() + count;
+
+        for (const char *c = start; c < end; c++) {
+            if (*c != ',' && *c != '\n')
+                continue;
+            if (pending.empty()) {
+                endField(start, c, *c == '\n');
+            } else {
+                pending.append(start, c);
+                endField(pending.data(), pending.data() + pending.size(), *c == '\n');
+                pending.clear();
+            }
+            if (*c == '\n') {
+                endRow();
+                line++;
+            }
+            start = c + 1;
+        }
+        pending.append(start, end);
+    }
+    if (!pending.empty() || rowValues > 0) {
+        endField(pending.data(), pending.data() + pending.size(), true);
+        endRow();
+    }
+
+    if (rows == 0)
+        throw std::runtime_error("CSV has no values");
+
+    Matrix result(rows, cols);
+    std::copy(values.begin(), values.end(), &result(0, 0));
+    return result;
+}
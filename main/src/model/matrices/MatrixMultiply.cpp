@@ -0,0 +1,258 @@
+/**
+ * @brief This class multiplies matrices with a blocked, multi-threaded kernel
+ *
+ * @details C = AB is split into MC x NC tiles of C. For every KC deep slice
+ * of the shared dimension a tile packs its rows of A into MR high slivers and
+ * its columns of B into NR wide slivers, both padded with zeros, and the
+ * micro-kernel adds each MR x NR block of the product into C. The packed
+ * slice of A stays in L2 and one sliver of B in L1 while it is reused.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../../../include/model/matrices/MatrixMultiply.h"
+#include "../../../include/model/utilities/CpuFeatures.h"
+#include "../../../include/model/utilities/WorkerPool.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MATRIX_MULTIPLY_X86
+#include <immintrin.h>
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+#endif
+
+namespace {
+    // register block of the micro-kernel
+    const int MR = 6;
+    const int NR = 8;
+
+    // cache blocks, MC and NC are multiples of MR and NR
+    const int MC = 96;
+    const int KC = 256;
+    const int NC = 512;
+
+    // products with fewer multiply-adds than this are not worth packing
+    const long smallProduct = 32 * 32 * 32;
+
+    // the same, for splitting the product over threads
+    const long parallelProduct = 128 * 128 * 128;
+
+    // adds the MR x NR product of a packed sliver of A and a packed sliver of B into c
+    typedef void (*MicroKernel)(int kc, const double *a, const double *b, double *c, int stride);
+
+    void portableKernel(int kc, const double *a, const double *b, double *c, int stride) {
+        double sum[MR][NR] = {};
+        for (int p = 0; p < kc; p++) {
+            for (int i = 0; i < MR; i++) {
+                for (int j = 0; j < NR; j++)
+                    sum[i][j] += a[i] * b[j];
+            }
+            a += MR;
+            b += NR;
+        }
+        for (int i = 0; i < MR; i++) {
+            for (int j = 0; j < NR; j++)
+                c[i * stride + j] += sum[i][j];
+        }
+    }
+
+#ifdef MATRIX_MULTIPLY_X86
+    AVX2_TARGET void avx2Kernel(int kc, const double *a, const double *b, double *c, int stride) {
+        __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+        __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+        __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+        __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+        __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+        __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+        for (int p = 0; p < kc; p++) {
+            __m256d b0 = _mm256_loadu_pd(b);
+            __m256d b1 = _mm256_loadu_pd(b + 4);
+            __m256d ai;
+
+            ai = _mm256_broadcast_sd(a);
+            c00 = _mm256_fmadd_pd(ai, b0, c00);
+            c01 = _mm256_fmadd_pd(ai, b1, c01);
+            ai = _mm256_broadcast_sd(a + 1);
+            c10 = _mm256_fmadd_pd(ai, b0, c10);
+            c11 = _mm256_fmadd_pd(ai, b1, c11);
+            ai = _mm256_broadcast_sd(a + 2);
+            c20 = _mm256_fmadd_pd(ai, b0, c20);
+            c21 = _mm256_fmadd_pd(ai, b1, c21);
+            ai = _mm256_broadcast_sd(a + 3);
+            c30 = _mm256_fmadd_pd(ai, b0, c30);
+            c31 = _mm256_fmadd_pd(ai, b1, c31);
+            ai = _mm256_broadcast_sd(a + 4);
+            c40 = _mm256_fmadd_pd(ai, b0, c40);
+            c41 = _mm256_fmadd_pd(ai, b1, c41);
+            ai = _mm256_broadcast_sd(a + 5);
+            c50 = _mm256_fmadd_pd(ai, b0, c50);
+            c51 = _mm256_fmadd_pd(ai, b1, c51);
+
+            a += MR;
+            b += NR;
+        }
+
+        __m256d rows[MR][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+        for (int i = 0; i < MR; i++) {
+            double *row = c + i * stride;
+            _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), rows[i][0]));
+            _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), rows[i][1]));
+        }
+    }
+#endif
+
+    MicroKernel selectKernel() {
+#ifdef MATRIX_MULTIPLY_X86
+        if (CpuFeatures::hasAvx2())
+            return avx2Kernel;
+#endif
+        return portableKernel;
+    }
+
+    /**
+     * copy an mc x kc block of A into MR high slivers, each stored column by column
+     */
+    void packA(ConstMatrixView a, double *packed) {
+        for (int i = 0; i < a.rows(); i += MR) {
+            int height = std::min(MR, a.rows() - i);
+            for (int p = 0; p < a.cols(); p++) {
+                for (int r = 0; r < height; r++)
+                    packed[r] = a(i + r, p);
+                for (int r = height; r < MR; r++)
+                    packed[r] = 0;
+                packed += MR;
+            }
+        }
+    }
+
+    /**
+     * copy a kc x nc block of B into NR wide slivers, each stored row by row
+     */
+    void packB(ConstMatrixView b, double *packed) {
+        for (int j = 0; j < b.cols(); j += NR) {
+            int width = std::min(NR, b.cols() - j);
+            for (int p = 0; p < b.rows(); p++) {
+                const double *row = b.rowData(p) + j;
+                for (int s = 0; s < width; s++)
+                    packed[s] = row[s];
+                for (int s = width; s < NR; s++)
+                    packed[s] = 0;
+                packed += NR;
+            }
+        }
+    }
+
+    /**
+     * compute one MC x NC tile of C, the tile must be zero on entry
+     */
+    void multiplyTile(MicroKernel kernel, ConstMatrixView a, ConstMatrixView b, MatrixView c,
+                      std::vector<double> &packedA, std::vector<double> &packedB) {
+        int mc = c.rows();
+        int nc = c.cols();
+        // edge blocks are computed into a full size buffer and then added to C
+        double edge[MR * NR];
+
+        for (int pc = 0; pc < a.cols(); pc += KC) {
+            int kc = std::min(KC, a.cols() - pc);
+            packA(a.block(0, pc, mc, kc), packedA.data());
+            packB(b.block(pc, 0, kc, nc), packedB.data());
+
+            for (int jr = 0; jr < nc; jr += NR) {
+                int width = std::min(NR, nc - jr);
+                const double *slivB = packedB.data() + (size_t) jr * kc;
+                for (int ir = 0; ir < mc; ir += MR) {
+                    int height = std::min(MR, mc - ir);
+                    const double *slivA = packedA.data() + (size_t) ir * kc;
+                    if (height == MR && width == NR) {
+                        kernel(kc, slivA, slivB, &c(ir, jr), c.stride());
+                    } else {
+                        std::fill(edge, edge + MR * NR, 0);
+                        kernel(kc, slivA, slivB, edge, NR);
+                        for (int i = 0; i < height; i++) {
+                            for (int j = 0; j < width; j++)
+                                c(ir + i, jr + j) += edge[i * NR + j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * the plain loop for small products, ordered so the inner loop is contiguous
+     */
+    void multiplySmall(ConstMatrixView a, ConstMatrixView b, MatrixView c) {
+        for (int i = 0; i < a.rows(); i++) {
+            double *out = c.rowData(i);
+            for (int p = 0; p < a.cols(); p++) {
+                double value = a(i, p);
+                const double *row = b.rowData(p);
+                for (int j = 0; j < b.cols(); j++)
+                    out[j] += value * row[j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief compute C = AB
+ * @param a the left matrix, m x k
+ * @param b the right matrix, k x n
+ * @param c the m x n result, it must not overlap a or b
+ * @param threads the most threads to use, 0 for one per core
+ */
+void MatrixMultiply::multiply(ConstMatrixView a, ConstMatrixView b, MatrixView c, unsigned threads) {
+    if (a.cols() != b.rows() || c.rows() != a.rows() || c.cols() != b.cols())
+        throw std::runtime_error("matrix dimensions are incompatable for this operation");
+
+    for (int i = 0; i < c.rows(); i++)
+        std::fill(c.rowData(i), c.rowData(i) + c.cols(), 0);
+
+    long product = (long) a.rows() * a.cols() * b.cols();
+    if (product == 0)
+        return;
+    if (product < smallProduct) {
+        multiplySmall(a, b, c);
+        return;
+    }
+
+    static const MicroKernel kernel = selectKernel();
+    int tileRows = (c.rows() + MC - 1) / MC;
+    int tileCols = (c.cols() + NC - 1) / NC;
+    int tiles = tileRows * tileCols;
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    if (product < parallelProduct)
+        threads = 1;
+    threads = std::min<unsigned>(threads, tiles);
+
+    // every thread takes the next tile until there are none left
+    std::atomic<int> nextTile(0);
+    auto worker = [&]() {
+        std::vector<double> packedA((size_t) MC * KC);
+        std::vector<double> packedB((size_t) KC * NC);
+        for (int tile = nextTile++; tile < tiles; tile = nextTile++) {
+            int row = (tile / tileCols) * MC;
+            int col = (tile % tileCols) * NC;
+            int rows = std::min(MC, c.rows() - row);
+            int cols = std::min(NC, c.cols() - col);
+            multiplyTile(kernel, a.block(row, 0, rows, a.cols()), b.block(0, col, b.rows(), cols),
+                         c.block(row, col, rows, cols), packedA, packedB);
+        }
+    };
+
+    // a product that finds the shared pool claimed is done on its own thread
+    WorkerPool::Claim claim(threads > 1);
+    WorkerPool &pool = claim.pool();
+    pool.run(0, std::min(threads, pool.size()), [&](int begin, int end) {
+        for (int i = begin; i < end; i++)
+            worker();
+    });
+}
@@ -0,0 +1,299 @@
+/**
+ * @brief This class stores the Householder QR factorization of a matrix
+ *
+ * @details See QRDecomposition.h. Each reflector is H = I - tau v v^T with
+ * v[0] = 1, so only the rest of v is stored, below the diagonal.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "../../../include/model/matrices/QRDecomposition.h"
+
+namespace {
+    // the number of columns in a panel, the reflectors of a panel are applied to the rest together
+    const int panelWidth = 32;
+}
+
+/**
+ * @brief factor a matrix with at least as many rows as columns
+ * @details a diagonal entry of R smaller than the rounding error of the
+ * factorization marks the matrix as rank deficient
+ * @param values the matrix, or a block of one
+ */
+QRDecomposition::QRDecomposition(ConstMatrixView values) {
+    m = values.rows();
+    n = values.cols();
+    if (n == 0)
+        throw std::runtime_error("can not factor an empty matrix");
+    if (m < n)
+        throw std::runtime_error("can not factor a matrix with more columns than rows");
+
+    qr.resize((size_t) m * n);
+    tau.resize(n);
+    for (int row = 0; row < m; row++)
+        std::copy(values.rowData(row), values.rowData(row) + n, &qr[(size_t) row * n]);
+
+    for (int first = 0; first < n; first += panelWidth) {
+        int width = std::min(panelWidth, n - first);
+        factorPanel(first, width);
+        if (first + width < n)
+            applyPanel(first, width);
+    }
+
+    double largest = 0;
+    for (int k = 0; k < n; k++)
+        largest = std::max(largest, std::abs(qr[(size_t) k * n + k]));
+    const double tolerance = m * std::numeric_limits<double>::epsilon() * largest;
+    rankDeficient = false;
+    for (int k = 0; k < n; k++)
+        rankDeficient = rankDeficient || std::abs(qr[(size_t) k * n + k]) <= tolerance;
+}
+
+/**
+ * @brief factor the columns of one panel, applying each reflector only inside the panel
+ * @param first the first column of the panel
+ * @param width the number of columns in the panel
+ */
+void QRDecomposition::factorPanel(int first, int width) {
+    std::vector<double> w(width);
+    for (int k = first; k < first + width; k++) {
+        // the reflector that maps column k below the diagonal onto beta e_k
+        double alpha = qr[(size_t) k * n + k];
+        double norm = 0;
+        for (int row = k + 1; row < m; row++)
+            norm += qr[(size_t) row * n + k] * qr[(size_t) row * n + k];
+        norm = std::sqrt(norm);
+        if (norm == 0) {
+            tau[k] = 0;
+            continue;
+        }
+        double beta = -std::copysign(std::hypot(alpha, norm), alpha);
+        tau[k] = (beta - alpha) / beta;
+        double scale = 1 / (alpha - beta);
+        for (int row = k + 1; row < m; row++)
+            qr[(size_t) row * n + k] *= scale;
+        qr[(size_t) k * n + k] = beta;
+
+        // w = v^T A and A -= tau v w for the columns of the panel right of k, row by row
+        int end = first + width;
+        if (k + 1 == end)
+            continue;
+        std::fill(w.begin(), w.end(), 0);
+        for (int row = k; row < m; row++) {
+            const double *current = &qr[(size_t) row * n];
+            double v = row == k ? 1 : current[k];
+            for (int col = k + 1; col < end; col++)
+                w[col - first] += v * current[col];
+        }
+        for (int row = k; row < m; row++) {
+            double *current = &qr[(size_t) row * n];
+            double v = tau[k] * (row == k ? 1 : current[k]);
+            for (int col = k + 1; col < end; col++)
+                current[col] -= v * w[col - first];
+        }
+    }
+}
+
+/**
+ * @brief apply the transpose of the reflectors of a panel to the columns right of it
+ * @details the panel's reflectors multiply to Q = I - V T V^T with T upper
+ * triangular, so Q^T C = C - V (T^T (V^T C)) costs two sweeps over C
+ * @param first the first column of the panel
+ * @param width the number of columns in the panel
+ */
+void QRDecomposition::applyPanel(int first, int width) {
+    auto v = [&](int row, int i) {
+        int col = first + i;
+        return row == col ? 1.0 : row < col ? 0.0 : qr[(size_t) row * n + col];
+    };
+
+    // T(0:i, i) = -tau_i T(0:i, 0:i) V(:, 0:i)^T v_i
+    std::vector<double> t((size_t) width * width, 0);
+    std::vector<double> z(width);
+    for (int i = 0; i < width; i++) {
+        std::fill(z.begin(), z.begin() + i, 0);
+        for (int row = first + i; row < m; row++) {
+            double vi = v(row, i);
+            for (int l = 0; l < i; l++)
+                z[l] += v(row, l) * vi;
+        }
+        for (int l = 0; l < i; l++) {
+            double sum = 0;
+            for (int p = l; p < i; p++)
+                sum += t[(size_t) l * width + p] * z[p];
+            t[(size_t) l * width + i] = -tau[first + i] * sum;
+        }
+        t[(size_t) i * width + i] = tau[first + i];
+    }
+
+    int start = first + width;
+    int count = n - start;
+
+    // W = V^T C
+    std::vector<double> w((size_t) width * count, 0);
+    for (int row = first; row < m; row++) {
+        const double *current = &qr[(size_t) row * n + start];
+        for (int i = 0; i < width && first + i <= row; i++) {
+            double vi = v(row, i);
+            double *wRow = &w[(size_t) i * count];
+            for (int col = 0; col < count; col++)
+                wRow[col] += vi * current[col];
+        }
+    }
+
+    // W = T^T W, from the bottom up so the rows still needed are not overwritten
+    for (int i = width - 1; i >= 0; i--) {
+        double *wRow = &w[(size_t) i * count];
+        for (int col = 0; col < count; col++)
+            wRow[col] *= t[(size_t) i * width + i];
+        for (int l = 0; l < i; l++) {
+            double factor = t[(size_t) l * width + i];
+            const double *lRow = &w[(size_t) l * count];
+            for (int col = 0; col < count; col++)
+                wRow[col] += factor * lRow[col];
+        }
+    }
+
+    // C -= V W
+    for (int row = first; row < m; row++) {
+        double *current = &qr[(size_t) row * n + start];
+        for (int i = 0; i < width && first + i <= row; i++) {
+            double vi = v(row, i);
+            const double *wRow = &w[(size_t) i * count];
+            for (int col = 0; col < count; col++)
+                current[col] -= vi * wRow[col];
+        }
+    }
+}
+
+/**
+ * @brief get the number of rows of the factored matrix
+ * @return the number of rows
+ */
+int QRDecomposition::rows() const {
+    return m;
+}
+
+/**
+ * @brief get the number of columns of the factored matrix
+ * @return the number of columns
+ */
+int QRDecomposition::cols() const {
+    return n;
+}
+
+/**
+ * @brief check if the columns of the factored matrix are linearly dependent
+ * @return true if a diagonal entry of R was zero up to rounding
+ */
+bool QRDecomposition::isRankDeficient() const {
+    return rankDeficient;
+}
+
+/**
+ * @brief find the x that minimises ||b - Ax||
+ * @param b the right hand side
+ * @return the least squares solution and its residual
+ */
+QRDecomposition::Result QRDecomposition::solve(const std::vector<double> &b) const {
+    if ((int) b.size() != m)
+        throw std::runtime_error("matrix dimensions are incompatable for this operation");
+
+    std::vector<double> residualNorms;
+    Matrix x = solve(ConstMatrixView(b.data(), m, 1, 1), residualNorms);
+    Result result;
+    result.x.resize(n);
+    for (int row = 0; row < n; row++)
+        result.x[row] = x(row, 0);
+    result.residualNorm = residualNorms[0];
+    return result;
+}
+
+/**
+ * @brief find the least squares solutions for many right hand sides at once
+ * @details Q^T B is split into the first n rows, which give X by back
+ * substitution with R, and the rest, whose column norms are the residuals.
+ * Both go row by row through all the right hand sides.
+ * @param b the right hand sides, one per column
+ * @param residualNorms set to ||b - Ax|| of each column
+ * @return the least squares solutions, one per column
+ */
+Matrix QRDecomposition::solve(ConstMatrixView b, std::vector<double> &residualNorms) const {
+    if (b.rows() != m)
+        throw std::runtime_error("matrix dimensions are incompatable for this operation");
+    if (rankDeficient)
+        throw std::runtime_error("The system does not have a unique least squares solution");
+
+    int count = b.cols();
+    residualNorms.assign(count, 0);
+    Matrix x(n, count);
+    if (count == 0)
+        return x;
+
+    // Y = Q^T B, one reflector at a time
+    Matrix y(b);
+    std::vector<double> sums(count);
+    for (int k = 0; k < n; k++) {
+        if (tau[k] == 0)
+            continue;
+        std::copy(&y(k, 0), &y(k, 0) + count, sums.begin());
+        for (int row = k + 1; row < m; row++) {
+            double v = qr[(size_t) row * n + k];
+            const double *current = &y(row, 0);
+            for (int j = 0; j < count; j++)
+                sums[j] += v * current[j];
+        }
+        for (int j = 0; j < count; j++)
+            sums[j] *= tau[k];
+        double *first = &y(k, 0);
+        for (int j = 0; j < count; j++)
+            first[j] -= sums[j];
+        for (int row = k + 1; row < m; row++) {
+            double v = qr[(size_t) row * n + k];
+            double *current = &y(row, 0);
+            for (int j = 0; j < count; j++)
+                current[j] -= v * sums[j];
+        }
+    }
+
+    for (int row = n; row < m; row++) {
+        const double *current = &y(row, 0);
+        for (int j = 0; j < count; j++)
+            residualNorms[j] += current[j] * current[j];
+    }
+    for (double &norm: residualNorms)
+        norm = std::sqrt(norm);
+
+    for (int row = n - 1; row >= 0; row--) {
+        const double *current = &qr[(size_t) row * n];
+        double *result = &x(row, 0);
+        std::copy(&y(row, 0), &y(row, 0) + count, result);
+        for (int col = row + 1; col < n; col++) {
+            const double *known = &x(col, 0);
+            for (int j = 0; j < count; j++)
+                result[j] -= current[col] * known[j];
+        }
+        for (int j = 0; j < count; j++)
+            result[j] /= current[row];
+    }
+    return x;
+}
+
+/**
+ * @brief get the upper triangular factor
+ * @return R, n x n
+ */
+Matrix QRDecomposition::r() const {
+    Matrix result(n, n);
+    for (int row = 0; row < n; row++) {
+        for (int col = row; col < n; col++)
+            result(row, col) = qr[(size_t) row * n + col];
+    }
+    return result;
+}
@@ -0,0 +1,211 @@
+/**
+ * @brief This class represents an exact fraction of two integers
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+#include "../../../include/model/matrices/Rational.h"
+
+namespace {
+    // fromDouble only accepts fractions with at most this denominator
+    const long long maxDenominator = 1000000000;
+
+    // and only if they are this close to the double, relative to its size
+    const double tolerance = 1e-12;
+
+    void overflow() {
+        throw std::runtime_error("number is too large for exact arithmetic");
+    }
+}
+
+/**
+ * @brief create the fraction numerator / denominator in lowest terms
+ * @param numerator the numerator
+ * @param denominator the denominator, must not be 0
+ */
+Rational::Rational(long long numerator, long long denominator) {
+    if (denominator == 0)
+        throw std::runtime_error("Division by zero");
+    if (numerator == std::numeric_limits<long long>::min() || denominator == std::numeric_limits<long long>::min())
+        overflow();
+    if (denominator < 0) {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+    long long divisor = gcd(numerator, denominator);
+    Rational::numerator = numerator / divisor;
+    Rational::denominator = denominator / divisor;
+}
+
+/**
+ * @brief find the simplest fraction that a double stands for
+ * @details walks the continued fraction of value until a convergent is within
+ * rounding error of it, so 0.1 gives 1/10 and 1.0 / 3 gives 1/3
+ * @param value the double to convert
+ * @return the fraction
+ */
+Rational Rational::fromDouble(double value) {
+    if (!std::isfinite(value) || std::fabs(value) >= 9e18)
+        overflow();
+
+    // the last two convergents h / k of the continued fraction
+    long long h0 = 0, h1 = 1;
+    long long k0 = 1, k1 = 0;
+    double rest = value;
+    while (true) {
+        double whole = std::floor(rest);
+        if (std::fabs(whole) >= 9e18)
+            overflow();
+        long long term = (long long) whole;
+        long long h2 = add(multiply(term, h1), h0);
+        long long k2 = add(multiply(term, k1), k0);
+        if (k2 > maxDenominator)
+            throw std::runtime_error("number can not be represented exactly");
+        h0 = h1;
+        h1 = h2;
+        k0 = k1;
+        k1 = k2;
+
+        double fraction = rest - whole;
+        if (fraction == 0 || std::fabs(value - (double) h1 / k1) <= tolerance * std::fmax(1, std::fabs(value)))
+            return Rational(h1, k1);
+        rest = 1 / fraction;
+    }
+}
+
+Rational Rational::operator+(const Rational &other) const {
+    long long divisor = gcd(denominator, other.denominator);
+    long long left = multiply(numerator, other.denominator / divisor);
+    long long right = multiply(other.numerator, denominator / divisor);
+    return Rational(add(left, right), multiply(denominator / divisor, other.denominator));
+}
+
+Rational Rational::operator-(const Rational &other) const {
+    return *this + -other;
+}
+
+Rational Rational::operator*(const Rational &other) const {
+    // cancel across first so the products stay as small as possible
+    long long first = gcd(numerator, other.denominator);
+    long long second = gcd(other.numerator, denominator);
+    return Rational(multiply(numerator / first, other.numerator / second),
+                    multiply(denominator / second, other.denominator / first));
+}
+
+Rational Rational::operator/(const Rational &other) const {
+    if (other.numerator == 0)
+        throw std::runtime_error("Division by zero");
+    return *this * Rational(other.denominator, other.numerator);
+}
+
+Rational Rational::operator-() const {
+    Rational result = *this;
+    result.numerator = -numerator;
+    return result;
+}
+
+bool Rational::operator==(const Rational &other) const {
+    return numerator == other.numerator && denominator == other.denominator;
+}
+
+bool Rational::operator!=(const Rational &other) const {
+    return !(*this == other);
+}
+
+long long Rational::getNumerator() const {
+    return numerator;
+}
+
+long long Rational::getDenominator() const {
+    return denominator;
+}
+
+bool Rational::isZero() const {
+    return numerator == 0;
+}
+
+double Rational::toDouble() const {
+    return (double) numerator / denominator;
+}
+
+/**
+ * @brief write the fraction as "n/d", or just "n" for a whole number
+ * @return the fraction as a string
+ */
+std::string Rational::toString() const {
+    if (denominator == 1)
+        return std::to_string(numerator);
+    return std::to_string(numerator) + "/" + std::to_string(denominator);
+}
+
+/**
+ * @brief the greatest common divisor, 1 if both are 0
+ */
+long long Rational::gcd(long long a, long long b) {
+    a = a < 0 ? -a : a;
+    b = b < 0 ? -b : b;
+    while (b != 0) {
+        long long rest = a % b;
+        a = b;
+        b = rest;
+    }
+    return a == 0 ? 1 : a;
+}
+
+/**
+ * @brief a * b, throwing instead of overflowing
+ */
+long long Rational::multiply(long long a, long long b) {
+    long long result;
+#if defined(__GNUC__)
+    if (__builtin_mul_overflow(a, b, &result))
+        overflow();
+#else
+    if (a != 0 && b != 0 && (std::llabs(a) > std::numeric_limits<long long>::max() / std::llabs(b)
+                             || a == std::numeric_limits<long long>::min()
+                             || b == std::numeric_limits<long long>::min()))
+        overflow();
+    result = a * b;
+#endif
+    return result;
+}
+
+/**
+ * @brief a + b, throwing instead of overflowing
+ */
+long long Rational::add(long long a, long long b) {
+    long long result;
+#if defined(__GNUC__)
+    if (__builtin_add_overflow(a, b, &result))
+        overflow();
+#else
+    if ((b > 0 && a > std::numeric_limits<long long>::max() - b)
+            || (b < 0 && a < std::numeric_limits<long long>::min() - b))
+        overflow();
+    result = a + b;
+#endif
+    return result;
+}
+
+/**
+ * @brief a - b, throwing instead of overflowing
+ */
+long long Rational::subtract(long long a, long long b) {
+    long long result;
+#if defined(__GNUC__)
+    if (__builtin_sub_overflow(a, b, &result))
+        overflow();
+#else
+    if ((b < 0 && a > std::numeric_limits<long long>::max() + b)
+            || (b > 0 && a < std::numeric_limits<long long>::min() + b))
+        overflow();
+    result = a - b;
+#endif
+    return result;
+}
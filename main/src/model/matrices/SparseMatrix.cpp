@@ -0,0 +1,319 @@
+/**
+ * @brief This class represents matrices that are mostly zeros
+ *
+ * @details The non-zero values are stored in compressed sparse row (CSR) form:
+ * the values and their columns row after row, and the offset where every row
+ * starts. Memory grows with the number of non-zeros rather than with
+ * rows x cols.
+ *
+ * @author Michael Dias
+ * @version 0.1
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "../../../include/model/matrices/SparseMatrix.h"
+
+namespace {
+    // a row during elimination, (column, value) pairs ordered by column
+    typedef std::vector<std::pair<int, double>> Row;
+
+    // the same cut off as Matrix uses for its row operations
+    const double zeroTolerance = 0.0001;
+
+    /**
+     * add multiple * other to row, dropping values that become (almost) zero
+     */
+    void addMultipleOfRow(Row &row, const Row &other, double multiple, Row &scratch) {
+        scratch.clear();
+        size_t i = 0;
+        size_t j = 0;
+        while (i < row.size() || j < other.size()) {
+            int col;
+            double value;
+            if (j == other.size() || (i < row.size() && row[i].first < other[j].first)) {
+                col = row[i].first;
+                value = row[i++].second;
+            } else if (i == row.size() || other[j].first < row[i].first) {
+                col = other[j].first;
+                value = multiple * other[j++].second;
+            } else {
+                col = row[i].first;
+                value = row[i++].second + multiple * other[j++].second;
+            }
+            if (std::abs(value) >= zeroTolerance)
+                scratch.emplace_back(col, value);
+        }
+        row.swap(scratch);
+    }
+
+    /**
+     * multiply row by scalar, dropping values that become (almost) zero
+     */
+    void scaleRow(Row &row, double scalar) {
+        size_t kept = 0;
+        for (const std::pair<int, double> &entry: row) {
+            double value = entry.second * scalar;
+            if (std::abs(value) >= zeroTolerance)
+                row[kept++] = std::make_pair(entry.first, value);
+        }
+        row.resize(kept);
+    }
+}
+
+/**
+ * @brief Construct a new SparseMatrix of zeros
+ * @param rows the number of rows
+ * @param cols the number of columns
+ */
+SparseMatrix::SparseMatrix(int rows, int cols) : rows(rows), cols(cols), rowStart(rows + 1, 0) {}
+
+/**
+ * @brief Construct a new SparseMatrix from its non-zero entries
+ * @details entries can be in any order, entries at the same position are added together
+ * and positions that add up to 0 are not stored
+ * @param rows the number of rows
+ * @param cols the number of columns
+ * @param entries the row, column and value of each non-zero
+ */
+SparseMatrix::SparseMatrix(int rows, int cols, std::vector<Entry> entries) : SparseMatrix(rows, cols) {
+    for (const Entry &entry: entries) {
+        if (entry.row < 0 || entry.row >= rows || entry.col < 0 || entry.col >= cols)
+            throw std::runtime_error("matrix entry is out of range");
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+        return a.row != b.row ? a.row < b.row : a.col < b.col;
+    });
+
+    for (size_t i = 0; i < entries.size();) {
+        Entry entry = entries[i++];
+        while (i < entries.size() && entries[i].row == entry.row && entries[i].col == entry.col)
+            entry.value += entries[i++].value;
+        if (entry.value != 0) {
+            colIndex.push_back(entry.col);
+            values.push_back(entry.value);
+            rowStart[entry.row + 1]++;
+        }
+    }
+    for (int row = 0; row < rows; row++)
+        rowStart[row + 1] += rowStart[row];
+}
+
+/**
+ * @brief Construct a new SparseMatrix with the non-zeros of a dense Matrix
+ * @param dense the matrix to compress
+ * @param tolerance values with an absolute value up to this are left out
+ */
+SparseMatrix::SparseMatrix(const Matrix &dense, double tolerance) : SparseMatrix(dense.getRows(), dense.getCols()) {
+    for (int row = 0; row < rows; row++) {
+        ConstMatrixView entries = dense.row(row);
+        for (int col = 0; col < cols; col++) {
+            if (std::abs(entries(0, col)) > tolerance) {
+                colIndex.push_back(col);
+                values.push_back(entries(0, col));
+            }
+        }
+        rowStart[row + 1] = values.size();
+    }
+}
+
+/**
+ * @brief expand the matrix to dense storage
+ * @return the Matrix with the same values
+ */
+Matrix SparseMatrix::toMatrix() const {
+    Matrix dense(rows, cols);
+    for (int row = 0; row < rows; row++) {
+        for (int k = rowStart[row]; k < rowStart[row + 1]; k++)
+            dense(row, colIndex[k]) = values[k];
+    }
+    return dense;
+}
+
+/**
+ * @brief transposes the current matrix
+ * @details counts the non-zeros of every column first, so it runs in O(rows + cols + non-zeros)
+ * @return the transposed matrix
+ */
+SparseMatrix SparseMatrix::transpose() const {
+    SparseMatrix result(cols, rows);
+    result.colIndex.resize(values.size());
+    result.values.resize(values.size());
+
+    for (int col: colIndex)
+        result.rowStart[col + 1]++;
+    for (int col = 0; col < cols; col++)
+        result.rowStart[col + 1] += result.rowStart[col];
+
+    // walking the rows in order keeps the columns of the result sorted
+    std::vector<int> next(result.rowStart.begin(), result.rowStart.end() - 1);
+    for (int row = 0; row < rows; row++) {
+        for (int k = rowStart[row]; k < rowStart[row + 1]; k++) {
+            int position = next[colIndex[k]]++;
+            result.colIndex[position] = row;
+            result.values[position] = values[k];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief multiply the matrix with a vector
+ * @param x the vector, with one value per column
+ * @return the product, with one value per row
+ */
+std::vector<double> SparseMatrix::multiply(const std::vector<double> &x) const {
+    if ((int) x.size() != cols)
+        throw std::runtime_error("matrix dimensions are incompatable for this operation");
+
+    std::vector<double> result(rows);
+    for (int row = 0; row < rows; row++) {
+        double sum = 0;
+        for (int k = rowStart[row]; k < rowStart[row + 1]; k++)
+            sum += values[k] * x[colIndex[k]];
+        result[row] = sum;
+    }
+    return result;
+}
+
+/**
+ * @brief reduces the current matrix to row-reduced echelon form
+ * @details follows Matrix::reduceToRREF, but every row operation only touches the
+ * non-zeros of the two rows, so work and memory follow the non-zeros and their fill-in
+ */
+void SparseMatrix::reduceToRREF() {
+    std::vector<Row> work(rows);
+    for (int row = 0; row < rows; row++) {
+        for (int k = rowStart[row]; k < rowStart[row + 1]; k++)
+            work[row].emplace_back(colIndex[k], values[k]);
+    }
+    Row scratch;
+
+    // Reduce to REF, the rows below pivot_row have no entries left of pivot_col
+    int pivot_row = 0;
+    for (int pivot_col = 0; pivot_col < cols && pivot_row < rows; pivot_col++) {
+        // Get highest absolute value in pivot_col under pivot_row
+        int max_index = -1;
+        double max = 0;
+        for (int i = pivot_row; i < rows; i++) {
+            if (!work[i].empty() && work[i][0].first == pivot_col && std::abs(work[i][0].second) > max) {
+                max = std::abs(work[i][0].second);
+                max_index = i;
+            }
+        }
+        if (max_index == -1)    // Column entries under pivot_row are all zero
+            continue;
+
+        work[pivot_row].swap(work[max_index]);
+        double pivot = work[pivot_row][0].second;
+        for (int i = pivot_row + 1; i < rows; i++) {
+            if (!work[i].empty() && work[i][0].first == pivot_col)
+                addMultipleOfRow(work[i], work[pivot_row], -(work[i][0].second / pivot), scratch);
+        }
+        pivot_row++;
+    }
+
+    // Multiply rows such that all leading entries are 1
+    for (Row &row: work) {
+        if (!row.empty())
+            scaleRow(row, 1 / row[0].second);
+    }
+
+    // Make entries above each leading 1 zero, from the bottom row up
+    for (int i = pivot_row - 1; i > 0; i--) {
+        if (work[i].empty())
+            continue;
+        int col = work[i][0].first;
+        for (int above = 0; above < i; above++) {
+            Row &row = work[above];
+            auto entry = std::lower_bound(row.begin(), row.end(), col,
+                                          [](const std::pair<int, double> &e, int c) { return e.first < c; });
+            if (entry != row.end() && entry->first == col)
+                addMultipleOfRow(row, work[i], -entry->second, scratch);
+        }
+    }
+
+    colIndex.clear();
+    values.clear();
+    for (int row = 0; row < rows; row++) {
+        for (const std::pair<int, double> &entry: work[row]) {
+            colIndex.push_back(entry.first);
+            values.push_back(entry.second);
+        }
+        rowStart[row + 1] = values.size();
+    }
+}
+
+/**
+ * @brief get one value of the matrix
+ * @param row the index of the row
+ * @param col the index of the column
+ * @return the value, 0 if it is not stored
+ */
+double SparseMatrix::at(int row, int col) const {
+    auto begin = colIndex.begin() + rowStart[row];
+    auto end = colIndex.begin() + rowStart[row + 1];
+    auto found = std::lower_bound(begin, end, col);
+    return (found != end && *found == col) ? values[found - colIndex.begin()] : 0;
+}
+
+/**
+ * @brief returns the number of rows of the matrix
+ * @return the number of rows
+ */
+int SparseMatrix::getRows() const {
+    return rows;
+}
+
+/**
+ * @brief returns the number of columns of the matrix
+ * @return the number of columns
+ */
+int SparseMatrix::getCols() const {
+    return cols;
+}
+
+/**
+ * @brief returns the number of stored values
+ * @return the number of non-zeros
+ */
+int SparseMatrix::nonZeros() const {
+    return values.size();
+}
+
+/**
+ * @brief returns the fraction of the values that are non-zero
+ * @return the density, from 0 to 1
+ */
+double SparseMatrix::density() const {
+    if (rows == 0 || cols == 0)
+        return 0;
+    return values.size() / ((double) rows * cols);
+}
+
+/**
+ * @brief returns where each row starts in the column indices and values, followed by the number of non-zeros
+ * @return rows + 1 offsets
+ */
+const std::vector<int> &SparseMatrix::getRowStart() const {
+    return rowStart;
+}
+
+/**
+ * @brief returns the column of each non-zero
+ * @return the column indices, row by row
+ */
+const std::vector<int> &SparseMatrix::getColIndex() const {
+    return colIndex;
+}
+
+/**
+ * @brief returns the non-zero values
+ * @return the values, row by row
+ */
+const std::vector<double> &SparseMatrix::getValues() const {
+    return values;
+}
@@ -0,0 +1,39 @@
+/**
+ * @brief This class reports the vector instruction sets of the running CPU
+ *
+ * @details The CpuFeatures class is used to pick vectorized kernels at
+ * runtime, so one binary can use AVX2 where it exists and still run on
+ * older processors. Every check returns false on non x86 targets.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include "../../../include/model/utilities/CpuFeatures.h"
+
+/**
+ * check if SSE2 can be used, it is part of every x86-64 processor
+ * @return true if SSE2 is available, false otherwise
+ */
+bool CpuFeatures::hasSse2() {
+#if defined(__x86_64__) || defined(_M_X64)
+    return true;
+#elif defined(__i386__) && defined(__GNUC__)
+    return __builtin_cpu_supports("sse2");
+#else
+    return false;
+#endif
+}
+
+/**
+ * check if AVX2 and FMA can be used, the kernels always need both
+ * @return true if AVX2 and FMA are available, false otherwise
+ */
+bool CpuFeatures::hasAvx2() {
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supported;
+#else
+    return false;
+#endif
+}
@@ -21,7 +21,7 @@ bool Utilities::equalTrees(Node *rootA, Node *rootB) {
     if(!rootA && !rootB) {
         return true;
     }
-    else if (rootA && rootB && rootA->getValue()->value == rootB->getValue()->value) {
+    else if (rootA && rootB && rootA->getValue()->getText() == rootB->getValue()->getText()) {
         if ((!rootA->getSpecialOp() && !rootB->getSpecialOp()) || (rootA->getSpecialOp() && rootB->getSpecialOp() &&
             rootA->getSpecialOp()->value == rootB->getSpecialOp()->value)) {
             bool equalLeft = equalTrees(rootA->getLeft(), rootB->getLeft());
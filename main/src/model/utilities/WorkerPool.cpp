@@ -0,0 +1,208 @@
+/**
+ * @brief This class runs a loop over a range on a fixed set of threads
+ *
+ * @details The threads are started once and reused for every call to run,
+ * which splits [begin, end) into one contiguous part per thread and returns
+ * when all parts are done. The calling thread does the first part.
+ * Exceptions are caught inside each part, so a throwing part neither
+ * terminates a worker nor lets run return while other parts still use the task.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#include "../../../include/model/utilities/WorkerPool.h"
+
+namespace {
+    // true while a Claim holds the shared pool
+    std::atomic<bool> sharedClaimed(false);
+
+    /**
+     * get the pool shared by the engine, it is started on first use
+     * @return the pool, with one thread per core
+     */
+    WorkerPool &sharedPool() {
+        static WorkerPool pool(std::max(1u, std::thread::hardware_concurrency()));
+        return pool;
+    }
+
+    /**
+     * get a pool without threads, it only runs tasks inline so any number of callers can share it
+     * @return the pool
+     */
+    WorkerPool &inlinePool() {
+        static WorkerPool pool(1);
+        return pool;
+    }
+}
+
+/**
+ * claim the shared pool
+ * @param wanted false to run inline without trying, e.g. for a problem too small to split
+ */
+WorkerPool::Claim::Claim(bool wanted) {
+    if (wanted && !sharedClaimed.exchange(true)) {
+        claimed = &sharedPool();
+    }
+}
+
+/**
+ * give the shared pool back if it was claimed
+ */
+WorkerPool::Claim::~Claim() {
+    if (claimed) {
+        sharedClaimed.store(false);
+    }
+}
+
+/**
+ * get the pool to run on
+ * @return the shared pool if it was claimed, otherwise a pool that runs everything inline
+ */
+WorkerPool &WorkerPool::Claim::pool() const {
+    return claimed ? *claimed : inlinePool();
+}
+
+/**
+ * start the threads of the pool
+ * @param threads the number of threads including the caller, 0 is treated as 1
+ */
+WorkerPool::WorkerPool(unsigned threads) {
+    for (unsigned i = 1; i < threads; i++) {
+        workers.emplace_back(&WorkerPool::work, this, i);
+    }
+}
+
+/**
+ * stop and join the threads of the pool
+ */
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    startCondition.notify_all();
+    for (std::thread &worker: workers) {
+        worker.join();
+    }
+}
+
+/**
+ * get the number of threads that share the work, including the caller
+ * @return the number of threads
+ */
+unsigned WorkerPool::size() const {
+    return workers.size() + 1;
+}
+
+/**
+ * run task over [begin, end), split into one part per thread
+ * @param begin the first index
+ * @param end one past the last index
+ * @param task called once per thread with the part of the range it should do
+ */
+void WorkerPool::run(int begin, int end, const std::function<void(int, int)> &task) {
+    if (end <= begin) {
+        return;
+    }
+    if (workers.empty()) {
+        task(begin, end);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        WorkerPool::task = &task;
+        WorkerPool::begin = begin;
+        WorkerPool::end = end;
+        pending = workers.size();
+        generation++;
+    }
+    startCondition.notify_all();
+
+    int partBegin, partEnd;
+    part(0, partBegin, partEnd);
+    if (partBegin < partEnd) {
+        try {
+            task(partBegin, partEnd);
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    }
+
+    std::exception_ptr thrown;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCondition.wait(lock, [&]() { return pending == 0; });
+        thrown = error;
+        error = nullptr;
+    }
+    if (thrown) {
+        std::rethrow_exception(thrown);
+    }
+}
+
+/**
+ * keep the first exception of the current step, it is rethrown once every part is done
+ * @param exception the exception thrown by a part
+ */
+void WorkerPool::fail(std::exception_ptr exception) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!error) {
+        error = exception;
+    }
+}
+
+/**
+ * get the part of the current range done by one thread
+ * @param index the thread, 0 is the caller of run
+ * @param partBegin set to the first index of the part
+ * @param partEnd set to one past the last index of the part
+ */
+void WorkerPool::part(unsigned index, int &partBegin, int &partEnd) const {
+    long count = end - begin;
+    long threads = size();
+    partBegin = begin + (int) (count * index / threads);
+    partEnd = begin + (int) (count * (index + 1) / threads);
+}
+
+/**
+ * the loop of a worker thread, it does its part of every step until the pool is destroyed
+ * @param index the index of the thread
+ */
+void WorkerPool::work(unsigned index) {
+    unsigned seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        startCondition.wait(lock, [&]() { return stopping || generation != seen; });
+        if (stopping) {
+            return;
+        }
+        seen = generation;
+
+        int partBegin, partEnd;
+        part(index, partBegin, partEnd);
+        const std::function<void(int, int)> &current = *task;
+        lock.unlock();
+        std::exception_ptr thrown;
+        if (partBegin < partEnd) {
+            try {
+                current(partBegin, partEnd);
+            } catch (...) {
+                thrown = std::current_exception();
+            }
+        }
+        lock.lock();
+
+        if (thrown && !error) {
+            error = thrown;
+        }
+
+        if (--pending == 0) {
+            doneCondition.notify_one();
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @brief Tests of the batch evaluator.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <sstream>
+#include <string>
+
+#include "../../include/cli/BatchEvaluator.h"
+#include "../../include/tests/Tests.h"
+
+namespace {
+    /**
+     * count the lines of an output, the last line ends in a line break
+     * @param text the output
+     * @return the number of line breaks
+     */
+    std::size_t countLines(const std::string &text) {
+        std::size_t lines = 0;
+        for (char c: text) {
+            if (c == '\n') {
+                lines++;
+            }
+        }
+        return lines;
+    }
+}
+
+/**
+ * run the tests of the batch evaluator
+ */
+void Tests::batchEvaluator() {
+    BatchEvaluator evaluator({2, false, false, 16});
+
+    // an invalid character gives an error whose message ends in a line break
+    bool failed = false;
+    std::string result = evaluator.evaluate("2 $ 3", failed);
+    check(failed, "an invalid character fails");
+    check(result.rfind("error: ", 0) == 0, "a failed line starts with \"error: \"");
+    check(result.find_first_of("\n\r\t") == std::string::npos, "an error message fits on one line");
+
+    // one output line per input line, in order, with bad lines in between
+    std::ostringstream input;
+    for (int i = 0; i < 1000; i++) {
+        input << i << "+1\n" << "2 $ " << i << "\n";
+    }
+    input << "\n" << "7*6\n";
+    std::istringstream in(input.str());
+    std::ostringstream out;
+    evaluator.run(in, out);
+    std::string output = out.str();
+    check(countLines(output) == 2002, "every input line gives exactly one output line");
+
+    std::istringstream lines(output);
+    std::string line;
+    bool ordered = true;
+    for (int i = 0; i < 1000 && ordered; i++) {
+        std::getline(lines, line);
+        ordered = line == std::to_string(i + 1);
+        std::getline(lines, line);
+        ordered = ordered && line.rfind("error: ", 0) == 0;
+    }
+    check(ordered, "results are written in input order");
+    std::getline(lines, line);
+    check(line.empty(), "an empty line gives an empty line");
+    std::getline(lines, line);
+    check(line == "42", "the last line is solved");
+}
@@ -0,0 +1,56 @@
+/**
+ * @brief Tests of the exact arithmetic used to solve systems without rounding.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <string>
+#include <vector>
+
+#include "../../include/controller/compute/ComputeSysOfLinearEqn.h"
+#include "../../include/model/matrices/ExactMatrix.h"
+#include "../../include/model/matrices/Rational.h"
+#include "../../include/tests/Tests.h"
+
+/**
+ * run the tests of the exact arithmetic
+ */
+void Tests::exactArithmetic() {
+    // a double becomes the simplest fraction within its rounding error
+    check(Rational::fromDouble(0.1) == Rational(1, 10), "0.1 is 1/10");
+    check(Rational::fromDouble(1.0 / 3) == Rational(1, 3), "1.0 / 3 is 1/3");
+    check(Rational::fromDouble(-2.5).toString() == "-5/2", "-2.5 is -5/2");
+
+    // the first row has no x, so it is exchanged with the second
+    Matrix augmented(2, 3);
+    augmented(0, 1) = 1;
+    augmented(0, 2) = 1;
+    augmented(1, 0) = 2;
+    augmented(1, 1) = 1;
+    augmented(1, 2) = 4;
+    ExactMatrix reduced(augmented);
+    reduced.reduceToRREF();
+    check(reduced.at(0, 0) == Rational(1) && reduced.at(0, 1).isZero() && reduced.at(0, 2) == Rational(3, 2)
+          && reduced.at(1, 1) == Rational(1) && reduced.at(1, 2) == Rational(1),
+          "exact elimination exchanges a row without a pivot");
+
+    ComputeSysOfLinearEqn exact(ComputeSysOfLinearEqn::Arithmetic::Exact);
+    check(exact.solve({"y=1", "2x+y=4"}) == std::vector<std::string>({"x = 3/2", "y = 1"}),
+          "an exact solution is given as fractions");
+
+    // more unknowns than equations give fractions in terms of a parameter
+    check(exact.solve({"x+2y+3z=1", "2x+y=1"})
+          == std::vector<std::string>({"x = w + 1/3", "y = -2w + 1/3", "z = w"}),
+          "a parametric exact solution keeps its fractions");
+
+    // values that outgrow 64 bit integers are solved with doubles instead
+    std::vector<std::string> large = {"1000000007x+1000000009y=1", "1000000021x+1000000033y=2"};
+    std::vector<std::string> result = exact.solve(large);
+    bool fractions = false;
+    for (const std::string &line: result) {
+        fractions = fractions || line.find('/') != std::string::npos;
+    }
+    check(!fractions && result == ComputeSysOfLinearEqn().solve(large),
+          "an exact system that overflows falls back to doubles");
+}
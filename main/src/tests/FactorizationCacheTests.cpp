@@ -0,0 +1,94 @@
+/**
+ * @brief Tests of the cache of factored coefficient matrices.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../../include/controller/compute/ComputeSysOfLinearEqn.h"
+#include "../../include/model/matrices/FactorizationCache.h"
+#include "../../include/tests/Tests.h"
+
+namespace {
+    /**
+     * build a nonsingular 3 x 3 matrix that differs with its seed
+     * @param seed added to the diagonal
+     * @return the matrix
+     */
+    Matrix square(int seed) {
+        Matrix matrix(3, 3);
+        for (int row = 0; row < 3; row++) {
+            for (int col = 0; col < 3; col++) {
+                matrix(row, col) = row == col ? 10 + seed : row + col;
+            }
+        }
+        return matrix;
+    }
+
+    /**
+     * a hash that puts every matrix in the same place
+     * @return 0
+     */
+    std::uint64_t collide(ConstMatrixView) {
+        return 0;
+    }
+}
+
+/**
+ * run the tests of the factorization cache
+ */
+void Tests::factorizationCache() {
+    Matrix a = square(0), b = square(1), c = square(2);
+
+    // a matrix asked for again gets the factors kept the first time
+    FactorizationCache cache;
+    FactorizationCache::Factors first = cache.get(a.view());
+    check(first.lu && !first.qr && cache.get(a.view()).lu == first.lu && cache.size() == 1,
+          "a cached matrix is not factored again");
+    Matrix tall(4, 3);
+    for (int i = 0; i < 3; i++) {
+        tall(i, i) = 1;
+        tall(3, i) = 1;
+    }
+    check(cache.get(tall.view()).qr && !cache.get(tall.view()).lu, "a tall matrix is kept as QR factors");
+
+    // matrices with the same hash are told apart by their values
+    FactorizationCache colliding(std::size_t(1) << 20, collide);
+    FactorizationCache::Factors ofA = colliding.get(a.view());
+    FactorizationCache::Factors ofB = colliding.get(b.view());
+    check(ofA.lu != ofB.lu && colliding.get(a.view()).lu == ofA.lu && colliding.get(b.view()).lu == ofB.lu
+          && colliding.size() == 2, "matrices with the same hash get their own factors");
+
+    // room for two 3 x 3 entries, the least recently used one is dropped
+    FactorizationCache small(2 * 2 * 9);
+    ofA = small.get(a.view());
+    ofB = small.get(b.view());
+    small.get(a.view());
+    small.get(c.view());
+    check(small.size() == 2 && small.get(a.view()).lu == ofA.lu, "a recently used entry is kept");
+    check(small.get(b.view()).lu != ofB.lu, "the least recently used entry is dropped");
+    small.setMaxValues(0);
+    check(small.size() == 0, "lowering the limit drops the entries that no longer fit");
+
+    // every set of constants of a batch matches solving the system with them
+    FactorizationCache &shared = ComputeSysOfLinearEqn::factorizations();
+    shared.clear();
+    ComputeSysOfLinearEqn solver;
+    std::vector<std::vector<double>> constants = {{1, 2, 3}, {-4, 0.5, 6}};
+    std::vector<std::vector<std::string>> batch =
+            solver.solve({"2x+y+z=0", "x+3y=0", "y+4z=0"}, constants);
+    bool all = batch.size() == constants.size();
+    for (std::size_t j = 0; all && j < constants.size(); j++) {
+        std::vector<std::string> equations = {"2x+y+z=" + std::to_string(constants[j][0]),
+                                              "x+3y=" + std::to_string(constants[j][1]),
+                                              "y+4z=" + std::to_string(constants[j][2])};
+        all = batch[j] == solver.solve(equations);
+    }
+    check(all, "a batch of constants solves like each set on its own");
+    check(shared.size() == 1, "a batch and the systems with its coefficients share one entry");
+    shared.clear();
+}
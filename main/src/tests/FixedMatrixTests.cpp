@@ -0,0 +1,100 @@
+/**
+ * @brief Tests of the fixed size matrices against LU decomposition.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+// first, as on some systems it defines minor as a macro
+#include <sys/types.h>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../../include/model/matrices/FixedMatrix.h"
+#include "../../include/model/matrices/LUDecomposition.h"
+#include "../../include/tests/Tests.h"
+
+namespace {
+    /**
+     * check that the determinant and inverse of a matrix match those from LU decomposition
+     * @param matrix the matrix
+     * @param name the size of the matrix, for the failures
+     */
+    template <int N>
+    void compare(const FixedMatrix<N, N> &matrix, const std::string &name) {
+        Matrix dense = matrix.toMatrix();
+        LUDecomposition lu(dense.view());
+        double determinant = matrix.determinant();
+        Tests::check(std::abs(determinant - lu.determinant()) <= 1e-9 * std::max(1.0, std::abs(determinant)),
+                     name + " determinant matches LU");
+
+        Matrix expected = lu.inverse();
+        Matrix inverse = matrix.inverse().toMatrix();
+        double error = 0;
+        for (int row = 0; row < N; row++) {
+            for (int col = 0; col < N; col++) {
+                error = std::max(error, std::abs(inverse(row, col) - expected(row, col)));
+            }
+        }
+        Tests::check(error <= 1e-9, name + " inverse matches LU");
+    }
+
+    /**
+     * check that a singular matrix has no inverse either way
+     * @param matrix the matrix, with linearly dependent rows
+     * @param name the size of the matrix, for the failures
+     */
+    template <int N>
+    void compareSingular(const FixedMatrix<N, N> &matrix, const std::string &name) {
+        LUDecomposition lu(matrix.toMatrix().view());
+        Tests::check(lu.isSingular() && std::abs(matrix.determinant()) <= 1e-12 && lu.determinant() == 0,
+                     name + " singular determinant is 0");
+        bool threw = false;
+        try {
+            matrix.inverse();
+        } catch (std::runtime_error &) {
+            threw = true;
+        }
+        Tests::check(threw, name + " singular matrix has no inverse");
+    }
+
+    /**
+     * compare a random matrix and one whose last row is the sum of the others
+     * @param random the source of the values
+     */
+    template <int N>
+    void compareSize(std::mt19937 &random) {
+        std::string name = std::to_string(N) + "x" + std::to_string(N);
+        std::uniform_int_distribution<int> digit(-9, 9);
+        FixedMatrix<N, N> matrix;
+        for (int row = 0; row < N; row++) {
+            for (int col = 0; col < N; col++) {
+                matrix(row, col) = digit(random);
+            }
+            // keep it diagonally dominant, and so nonsingular
+            matrix(row, row) += 10 * N;
+        }
+        compare(matrix, name);
+
+        for (int col = 0; col < N; col++) {
+            matrix(N - 1, col) = 0;
+            for (int row = 0; row < N - 1; row++) {
+                matrix(N - 1, col) += matrix(row, col);
+            }
+        }
+        compareSingular(matrix, name);
+    }
+}
+
+/**
+ * run the tests of the fixed size matrices
+ */
+void Tests::fixedMatrix() {
+    std::mt19937 random(29);
+    compareSize<2>(random);
+    compareSize<3>(random);
+    compareSize<4>(random);
+}
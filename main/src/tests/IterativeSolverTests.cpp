@@ -0,0 +1,99 @@
+/**
+ * @brief Tests of the iterative solver.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../include/controller/compute/ComputeSysOfLinearEqn.h"
+#include "../../include/model/matrices/IterativeSolver.h"
+#include "../../include/tests/Tests.h"
+
+namespace {
+    const IterativeSolver::Method methods[] = {
+            IterativeSolver::Method::ConjugateGradient,
+            IterativeSolver::Method::BiCGSTAB,
+            IterativeSolver::Method::GMRES
+    };
+
+    const char *methodNames[] = {"CG", "BiCGSTAB", "GMRES"};
+
+    /**
+     * build the n x n matrix with 4 on the diagonal and -1 beside it
+     * @param n the number of rows
+     * @return the matrix, symmetric and positive definite
+     */
+    SparseMatrix tridiagonal(int n) {
+        std::vector<SparseMatrix::Entry> entries;
+        for (int i = 0; i < n; i++) {
+            entries.push_back({i, i, 4});
+            if (i > 0) {
+                entries.push_back({i, i - 1, -1});
+            }
+            if (i < n - 1) {
+                entries.push_back({i, i + 1, -1});
+            }
+        }
+        return SparseMatrix(n, n, entries);
+    }
+}
+
+/**
+ * run the tests of the iterative solver
+ */
+void Tests::iterativeSolver() {
+    const int n = 50;
+    SparseMatrix a = tridiagonal(n);
+    std::vector<double> expected(n);
+    for (int i = 0; i < n; i++) {
+        expected[i] = i + 1;
+    }
+    std::vector<double> b = a.multiply(expected);
+
+    for (int m = 0; m < 3; m++) {
+        std::string name = methodNames[m];
+        IterativeSolver::Options options;
+        options.method = methods[m];
+
+        // a nonsingular system converges to its solution
+        IterativeSolver solver(a);
+        IterativeSolver::Result result = solver.solve(b, options);
+        double error = 0;
+        for (int i = 0; i < n; i++) {
+            error = std::max(error, std::abs(result.x[i] - expected[i]));
+        }
+        check(result.converged && error < 1e-6, name + " solves a tridiagonal system");
+
+        // running out of iterations is reported, not taken as converged
+        options.maxIterations = 2;
+        result = solver.solve(b, options);
+        check(!result.converged && result.iterations == 2 && result.residual > options.tolerance,
+              name + " stops unconverged after maxIterations");
+
+        // a singular system converges to one of its solutions, which is not the answer
+        options.maxIterations = 1000;
+        ComputeSysOfLinearEqn iterative(options);
+        std::vector<std::string> singular = {"x+y=2", "2x+2y=4"};
+        check(iterative.solve(singular) == ComputeSysOfLinearEqn().solve(singular),
+              name + " leaves a singular system to elimination");
+    }
+
+    // ILU(0) needs every diagonal entry
+    IterativeSolver::Options options;
+    options.preconditioner = IterativeSolver::Preconditioner::ILU0;
+    IterativeSolver swapped(SparseMatrix(2, 2, {{0, 1, 1}, {1, 0, 1}}));
+    bool threw = false;
+    try {
+        swapped.solve({2, 3}, options);
+    } catch (std::runtime_error &) {
+        threw = true;
+    }
+    check(threw, "ILU(0) fails on a zero diagonal entry");
+    std::vector<std::string> result = ComputeSysOfLinearEqn(options).solve({"y=2", "x=3"});
+    check(result == std::vector<std::string>({"x = 3", "y = 2"}), "a zero diagonal entry falls back to elimination");
+}
@@ -0,0 +1,149 @@
+/**
+ * @brief Tests of reading and writing matrix files.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../include/model/matrices/MappedMatrix.h"
+#include "../../include/model/matrices/MatrixFile.h"
+#include "../../include/tests/Tests.h"
+
+namespace {
+    // the file the binary tests write, removed once they are done
+    const char *binaryPath = "matrix_file_test.bin";
+
+    /**
+     * write one field of a binary matrix file
+     * @param out the file
+     * @param value the field
+     */
+    template <typename T>
+    void writeField(std::ostream &out, T value) {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    /**
+     * write the 2 x 3 matrix [[1 2 3] [4 5 6]] in a given data type and layout
+     * @param dataType the type of the values
+     * @param layout the order of the values
+     */
+    void writeSample(MatrixFile::DataType dataType, MatrixFile::Layout layout) {
+        std::ofstream out(binaryPath, std::ios::binary | std::ios::trunc);
+        out.write("CMTX", 4);
+        writeField<std::uint32_t>(out, 1);
+        writeField<std::uint32_t>(out, (std::uint32_t) dataType);
+        writeField<std::uint32_t>(out, (std::uint32_t) layout);
+        writeField<std::uint64_t>(out, 2);
+        writeField<std::uint64_t>(out, 3);
+        const double rowMajor[] = {1, 2, 3, 4, 5, 6};
+        const double columnMajor[] = {1, 4, 2, 5, 3, 6};
+        const double *values = layout == MatrixFile::Layout::RowMajor ? rowMajor : columnMajor;
+        for (int i = 0; i < 6; i++) {
+            if (dataType == MatrixFile::DataType::Float32) {
+                writeField<float>(out, (float) values[i]);
+            } else {
+                writeField<double>(out, values[i]);
+            }
+        }
+    }
+
+    /**
+     * check that a view holds [[1 2 3] [4 5 6]]
+     * @param matrix the view
+     * @return true if it has the sample values
+     */
+    bool isSample(ConstMatrixView matrix) {
+        if (matrix.rows() != 2 || matrix.cols() != 3) {
+            return false;
+        }
+        for (int row = 0; row < 2; row++) {
+            for (int col = 0; col < 3; col++) {
+                if (matrix.rowData(row)[col] != row * 3 + col + 1) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * read CSV text
+     * @param text the CSV
+     * @param message set to the error if the text is rejected
+     * @return the matrix, 0 x 0 if the text is rejected
+     */
+    Matrix readCsv(const std::string &text, std::string &message) {
+        std::istringstream in(text);
+        try {
+            return MatrixFile::readCsv(in);
+        } catch (std::runtime_error &e) {
+            message = e.what();
+            return Matrix(0, 0);
+        }
+    }
+}
+
+/**
+ * run the tests of the matrix files
+ */
+void Tests::matrixFile() {
+    std::string message;
+
+    // CSV is read in chunks of 1 MiB, a value that starts in one chunk ends in the next
+    std::string text;
+    const int rows = (1 << 20) / 4;
+    for (int row = 0; row < rows - 1; row++) {
+        text += "1,2\n";
+    }
+    text += "123.5,7\n";
+    Matrix chunked = readCsv(text, message);
+    check(chunked.getRows() == rows && chunked.getCols() == 2 && chunked(rows - 1, 0) == 123.5
+          && chunked(rows - 1, 1) == 7 && chunked(rows - 2, 1) == 2, "a CSV value split between chunks is read whole");
+
+    Matrix crlf = readCsv("1,2\r\n3,4\r\n", message);
+    check(crlf.getRows() == 2 && crlf.getCols() == 2 && crlf(1, 0) == 3 && crlf(1, 1) == 4,
+          "CSV with CRLF line breaks is read");
+
+    message.clear();
+    readCsv("1,2\n\n3,4\n5\n", message);
+    check(message == "line 4 of CSV has 1 values, expected 2", "a ragged CSV row is reported on its line");
+
+    message.clear();
+    readCsv("1,2\n3,x\n", message);
+    check(message == "invalid number on line 2 of CSV", "a CSV value that is not a number is rejected");
+
+    // every data type and layout reads back the same, mapped or not
+    const MatrixFile::DataType dataTypes[] = {MatrixFile::DataType::Float64, MatrixFile::DataType::Float32};
+    const MatrixFile::Layout layouts[] = {MatrixFile::Layout::RowMajor, MatrixFile::Layout::ColumnMajor};
+    for (MatrixFile::DataType dataType: dataTypes) {
+        for (MatrixFile::Layout layout: layouts) {
+            std::string name = std::string(dataType == MatrixFile::DataType::Float32 ? "float32 " : "float64 ")
+                               + (layout == MatrixFile::Layout::ColumnMajor ? "column-major" : "row-major");
+            writeSample(dataType, layout);
+            MappedMatrix mapped(binaryPath);
+            check(isSample(mapped.view()), "a " + name + " file is mapped");
+            check(isSample(MatrixFile::read(binaryPath).view()), "a " + name + " file is read");
+        }
+    }
+
+    // a written file is doubles in row-major order, which is viewed in place
+    Matrix sample(2, 3);
+    for (int i = 0; i < 6; i++) {
+        sample(i / 3, i % 3) = i + 1;
+    }
+    MatrixFile::write(binaryPath, sample.view());
+    {
+        MappedMatrix mapped(binaryPath);
+        check(isSample(mapped.view()), "a written file round trips through MappedMatrix");
+    }
+    std::remove(binaryPath);
+}
@@ -0,0 +1,145 @@
+/**
+ * @brief Tests of the system of linear equations solver.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../../include/controller/compute/ComputeSysOfLinearEqn.h"
+#include "../../include/model/analyser/Lexer.h"
+#include "../../include/model/analyser/LinearSystem.h"
+#include "../../include/model/analyser/ParseSession.h"
+#include "../../include/model/analyser/Parser.h"
+#include "../../include/tests/Tests.h"
+
+namespace {
+    /**
+     * parse one equation into a system
+     * @param equation the equation
+     * @return the system of just that equation
+     */
+    LinearSystem parse(const std::string &equation) {
+        ParseSession session;
+        Lexer lexer(equation);
+        Parser parser = Parser();
+        parser.createParseTree(lexer.tokenizer());
+        LinearSystem system;
+        system.addEquation(parser.getRoot());
+        return system;
+    }
+
+    /**
+     * check that a line of a solution gives a variable one number
+     * @param line the line, such as "x = 2"
+     * @param variable the variable the line should be for
+     * @param expected the value the variable should have
+     * @return true if the line is the variable and a number close to the value
+     */
+    bool solves(const std::string &line, const std::string &variable, double expected) {
+        std::string prefix = variable + " = ";
+        if (line.compare(0, prefix.size(), prefix) != 0) {
+            return false;
+        }
+        const char *start = line.c_str() + prefix.size();
+        char *end = nullptr;
+        double value = std::strtod(start, &end);
+        return end != start && *end == '\0' && std::abs(value - expected) <= 1e-9;
+    }
+}
+
+/**
+ * run the tests of the system of linear equations solver
+ */
+void Tests::sysOfLinearEqn() {
+    ComputeSysOfLinearEqn solver;
+
+    // a leading '-' negates what follows it
+    SparseMatrix row = parse("-x+y=1").getAugmentedMatrix();
+    check(row.getRows() == 1 && row.getCols() == 3 && row.at(0, 0) == -1 && row.at(0, 1) == 1
+          && row.at(0, 2) == 1, "-x+y=1 gives the row [-1 1 | 1]");
+    std::vector<std::string> negated = solver.solve(std::vector<std::string>{"-2x=8"});
+    check(negated.size() == 1 && solves(negated[0], "x", -4), "-2x=8 gives x = -4");
+    negated = solver.solve(std::vector<std::string>{"x=-3"});
+    check(negated.size() == 1 && solves(negated[0], "x", -3), "x=-3 gives x = -3");
+
+    // 100 unknowns, each 4 times itself less its neighbours, is mostly zeros so it is
+    // reduced in sparse form; every pivot has to be read back as a leading 1. The
+    // neighbours go on the right as the parser groups a chain of "-" from the right
+    const int n = 100;
+    std::vector<std::string> equations;
+    for (int i = 1; i <= n; i++) {
+        int constant = 4 * i - (i > 1 ? i - 1 : 0) - (i < n ? i + 1 : 0);
+        std::string equation = "4x" + std::to_string(i) + "=";
+        if (i > 1) {
+            equation += "x" + std::to_string(i - 1) + "+";
+        }
+        if (i < n) {
+            equation += "x" + std::to_string(i + 1) + "+";
+        }
+        equations.push_back(equation + std::to_string(constant));
+    }
+    std::vector<std::string> result = solver.solve(equations);
+    check(result.size() == (std::size_t) n, "a tridiagonal system gives one line per unknown");
+    bool all = result.size() == (std::size_t) n;
+    for (int i = 1; all && i <= n; i++) {
+        all = solves(result[i - 1], "x" + std::to_string(i), i);
+    }
+    check(all, "a tridiagonal system of 100 unknowns gives each its value");
+
+    // a system this large is parsed in parts on the shared pool, each set of constants
+    // has to reach the row of its own equation
+    const int parsed = 300;
+    std::vector<std::string> unknowns;
+    std::vector<double> constants;
+    for (int i = 1; i <= parsed; i++) {
+        unknowns.push_back("x" + std::to_string(i) + "=0");
+        constants.push_back(i);
+    }
+    std::vector<std::vector<std::string>> batch = solver.solve(unknowns, {constants});
+    all = batch.size() == 1 && batch[0].size() == (std::size_t) parsed;
+    for (int i = 1; all && i <= parsed; i++) {
+        all = solves(batch[0][i - 1], "x" + std::to_string(i), i);
+    }
+    check(all, "the equations of a large system keep their order");
+
+    // when several parts fail the first bad equation is named
+    unknowns[99] = "x100=$";
+    unknowns[249] = "x250=$";
+    std::string message;
+    try {
+        solver.solve(unknowns);
+    } catch (std::exception &e) {
+        message = e.what();
+    }
+    check(message.compare(0, 19, "Equation 100 (x100=") == 0, "the first equation that fails is named");
+
+    // 20 unknowns each measured 11 times is sparse, and is fitted to the mean of each
+    std::vector<std::string> measurements;
+    for (int i = 1; i <= 20; i++) {
+        for (int k = -5; k <= 5; k++) {
+            measurements.push_back("x" + std::to_string(i) + "=" + std::to_string(i + k * 0.002));
+        }
+    }
+    result = solver.solve(measurements);
+    all = result.size() == 22 && result[0] == "There are no solutions for the given system, the least squares fit is"
+          && result[21].compare(0, 16, "residual norm = ") == 0;
+    for (int i = 1; all && i <= 20; i++) {
+        all = solves(result[i], "x" + std::to_string(i), i);
+    }
+    check(all, "a tall sparse system is fitted by least squares");
+
+    // a fit of more than 2^22 coefficients would need too large a dense copy
+    std::vector<std::string> huge;
+    for (int i = 1; i <= 2048; i++) {
+        huge.push_back("x" + std::to_string(i) + "=" + std::to_string(i));
+    }
+    huge.push_back("x1=5");
+    result = solver.solve(huge);
+    check(result.size() == 1 && result[0] == "There are no solutions for the given system",
+          "an inconsistent system too large to copy is not fitted");
+}
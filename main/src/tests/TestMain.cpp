@@ -0,0 +1,55 @@
+/**
+ * @brief Entry point of the headless regression tests.
+ *
+ * @details Runs the tests of every area and prints the number of checks
+ * that failed. The exit status is 0 only if all of them passed.
+ *
+ * usage: tests
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <iostream>
+
+#include "../../include/tests/Tests.h"
+
+namespace {
+    int checks = 0;
+    int failed = 0;
+}
+
+/**
+ * record the result of one check
+ * @param condition true if the check passed
+ * @param description what was checked, printed if it failed
+ */
+void Tests::check(bool condition, const std::string &description) {
+    checks++;
+    if (!condition) {
+        failed++;
+        std::cerr << "FAILED: " << description << std::endl;
+    }
+}
+
+/**
+ * get the number of failed checks
+ * @return the number of checks that did not pass
+ */
+int Tests::failures() {
+    return failed;
+}
+
+int main() {
+    Tests::batchEvaluator();
+    Tests::exactArithmetic();
+    Tests::factorizationCache();
+    Tests::fixedMatrix();
+    Tests::iterativeSolver();
+    Tests::matrixFile();
+    Tests::sysOfLinearEqn();
+    Tests::workerPool();
+
+    std::cout << checks - failed << " of " << checks << " checks passed" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+/**
+ * @brief Tests of the worker pool.
+ *
+ * @author Mihir Kadiya
+ * @version 1.0
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "../../include/model/utilities/WorkerPool.h"
+#include "../../include/tests/Tests.h"
+
+/**
+ * run the tests of the worker pool
+ */
+void Tests::workerPool() {
+    WorkerPool pool(4);
+
+    std::atomic<int> sum(0);
+    pool.run(0, 1000, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            sum += i;
+        }
+    });
+    check(sum == 999 * 1000 / 2, "every index of the range is visited once");
+
+    // the caller's part throws while the workers are still running theirs
+    std::atomic<int> finished(0);
+    std::string message;
+    try {
+        pool.run(0, 4, [&](int begin, int) {
+            if (begin == 0) {
+                throw std::runtime_error("first part");
+            }
+            for (volatile int i = 0; i < 1000000; i++) {}
+            finished++;
+        });
+    } catch (std::runtime_error &e) {
+        message = e.what();
+    }
+    check(message == "first part", "an exception of the caller's part is rethrown");
+    check(finished == 3, "run waits for the other parts before rethrowing");
+
+    // a worker's part throws
+    message.clear();
+    try {
+        pool.run(0, 4, [&](int begin, int) {
+            if (begin == 3) {
+                throw std::runtime_error("last part");
+            }
+        });
+    } catch (std::runtime_error &e) {
+        message = e.what();
+    }
+    check(message == "last part", "an exception of a worker's part is rethrown on the caller");
+
+    sum = 0;
+    pool.run(0, 100, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            sum += i;
+        }
+    });
+    check(sum == 99 * 100 / 2, "the pool can be used again after an exception");
+
+    // the shared pool is held by one claim at a time, the others run inline
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    {
+        WorkerPool::Claim first;
+        WorkerPool::Claim second;
+        check(first.pool().size() == cores && second.pool().size() == 1,
+              "a second claim of the shared pool runs inline");
+
+        // a claim made from inside a step, even on one of the pool's own threads, runs inline
+        std::atomic<int> nested(0);
+        first.pool().run(0, (int) cores, [&](int begin, int end) {
+            WorkerPool::Claim inner;
+            if (inner.pool().size() == 1) {
+                nested += end - begin;
+            }
+        });
+        check(nested == (int) cores, "a nested claim of the shared pool runs inline");
+    }
+    WorkerPool::Claim again;
+    check(again.pool().size() == cores, "the shared pool can be claimed again once it is released");
+    WorkerPool::Claim unwanted(false);
+    check(unwanted.pool().size() == 1, "a claim that is not wanted runs inline");
+}
@@ -5,6 +5,8 @@
  * @version 0.1
  */
 
+#include <algorithm>
+
 #include "../../include/model/utilities/Utilities.h"
 #include "../../include/view/GraphGUI.h"
 
@@ -247,19 +249,28 @@ void GraphGUI::graphClicked() {
 
     size = abs(first) + abs(second) + 1;
     try {
-        QVector<double> x(size), y(size);
+        std::vector<double> inputs(size);
         for (int i = 0; i < size; i++) {
-            x[i] = first++;
-            y[i] = ButtonResponder::solveGraphButtonResponse(function, Utilities::removeTrailingZeros(x[i]));
+            inputs[i] = first++;
+        }
+
+        // the function is parsed once and evaluated for every x value
+        std::vector<double> outputs = ButtonResponder::solveGraphButtonResponse(function, inputs);
+
+        // copied by hand, fromStdVector is deprecated and the range constructor needs Qt 5.14
+        QVector<double> x(size), y(size);
+        std::copy(inputs.begin(), inputs.end(), x.begin());
+        std::copy(outputs.begin(), outputs.end(), y.begin());
+        if (customPlot->graphCount() == 0) {
             customPlot->addGraph();
-            customPlot->graph(0)->setData(x, y); //adding data points to graph
-            // give axes some labels
-            customPlot->xAxis->setLabel("x");
-            customPlot->yAxis->setLabel("y");
-            // axes ranges are rescaled accordingly
-            customPlot->graph(0)->rescaleAxes();
-            customPlot->replot();
         }
+        customPlot->graph(0)->setData(x, y); //adding data points to graph
+        // give axes some labels
+        customPlot->xAxis->setLabel("x");
+        customPlot->yAxis->setLabel("y");
+        // axes ranges are rescaled accordingly
+        customPlot->graph(0)->rescaleAxes();
+        customPlot->replot();
     } catch (std::exception &e) {
         auto *error = new QErrorMessage();
         error->showMessage(QString::fromStdString(e.what()));
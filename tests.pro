@@ -0,0 +1,25 @@
+TARGET = tests
+TEMPLATE = app
+
+# headless regression tests for the engine and the batch evaluator
+CONFIG += console thread
+CONFIG -= qt app_bundle
+
+DESTDIR = main/bin
+OBJECTS_DIR = main/obj/tests
+
+HEADERS += main/include/cli/BatchEvaluator.h
+SOURCES += main/src/cli/BatchEvaluator.cpp
+
+HEADERS += main/include/tests/Tests.h
+SOURCES += main/src/tests/TestMain.cpp
+SOURCES += main/src/tests/BatchEvaluatorTests.cpp
+SOURCES += main/src/tests/ExactArithmeticTests.cpp
+SOURCES += main/src/tests/FactorizationCacheTests.cpp
+SOURCES += main/src/tests/FixedMatrixTests.cpp
+SOURCES += main/src/tests/IterativeSolverTests.cpp
+SOURCES += main/src/tests/MatrixFileTests.cpp
+SOURCES += main/src/tests/SysOfLinearEqnTests.cpp
+SOURCES += main/src/tests/WorkerPoolTests.cpp
+
+include(calccore.pri)